@@ -0,0 +1,92 @@
+#include "algorithms/cfs/cfs_algorithm.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+/*
+    Here is where you should define the logic for the CFS algorithm.
+*/
+
+CFSScheduler::CFSScheduler(int slice)
+{
+    if (slice == -1)
+    {
+        min_granularity = 3;
+    }
+    else
+    {
+        min_granularity = slice;
+    }
+    time_slice = min_granularity;
+}
+
+SchedulingDecision CFSScheduler::get_next_thread()
+{
+    if (timeline.empty())
+    {
+        SchedulingDecision emptyDecision;
+        emptyDecision.explain("No threads available for scheduling.");
+        emptyDecision.thread = nullptr;
+        emptyDecision.time_slice = -1;
+
+        return emptyDecision;
+    }
+
+    auto first = timeline.begin();
+    std::shared_ptr<Thread> nextThread = first->thread;
+    int64_t vruntime = first->vruntime;
+    int num_ready = timeline.size();
+    int weight = get_weight(nextThread);
+
+    // The thread's share of the target latency, spread over the threads that are waiting
+    int share = TARGET_LATENCY * (int64_t) weight / total_weight;
+    this->time_slice = std::max(min_granularity, share / num_ready);
+
+    timeline.erase(first);
+    total_weight -= weight;
+
+    SchedulingDecision decision;
+    decision.thread = nextThread;
+    decision.time_slice = time_slice;
+    decision.explain("Selected from {} threads (vruntime = {}). Will run for at most {} ticks.",
+                     num_ready, vruntime, time_slice);
+
+    return decision;
+}
+
+void CFSScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread)
+{
+    timeline.insert({get_vruntime(thread), next_sequence++, thread});
+    total_weight += get_weight(thread);
+}
+
+size_t CFSScheduler::size() const
+{
+    return timeline.size();
+}
+
+int CFSScheduler::get_weight(std::shared_ptr<Thread> thread)
+{
+    switch (thread->priority)
+    {
+    case ProcessPriority::SYSTEM:
+        return 88761;
+    case ProcessPriority::INTERACTIVE:
+        return 29154;
+    case ProcessPriority::NORMAL:
+        return NICE_0_WEIGHT;
+    case ProcessPriority::BATCH:
+        return 15;
+    default:
+        throw std::runtime_error("Error getting priority");
+    }
+}
+
+int64_t CFSScheduler::get_vruntime(std::shared_ptr<Thread> thread)
+{
+    return (int64_t) thread->service_time * NICE_0_WEIGHT / get_weight(thread);
+}
@@ -0,0 +1,75 @@
+#ifndef CFS_ALGORITHM_HPP
+#define CFS_ALGORITHM_HPP
+
+#include <cstdint>
+#include <memory>
+#include <set>
+#include "algorithms/scheduling_algorithm.hpp"
+
+/*
+    CFSScheduler:
+        A representation of the completely fair scheduling algorithm.
+
+        Every thread has a virtual runtime: the CPU time it has used, scaled down by a weight
+        that comes from its process priority (the Linux weights for nice values -20, -15, 0
+        and 19), in whole ticks. The thread with the lowest virtual runtime runs next, for a share of the
+        target latency proportional to its weight, but never less than the minimum
+        granularity given with -s, --time_slice.
+
+        Ready threads are kept in a red-black tree (std::set) ordered by virtual runtime,
+        with threads that have the same virtual runtime in the order they became ready, so
+        picking the next thread takes O(log n) time. The total weight of the ready threads
+        is kept as they come and go.
+*/
+
+class CFSScheduler : public Scheduler {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    static const int TARGET_LATENCY = 48;
+
+    // A thread with nice value 0 (NORMAL) has this weight, and its virtual runtime is its runtime
+    static const int NICE_0_WEIGHT = 1024;
+
+    // The shortest time slice a thread is given
+    int min_granularity;
+
+    struct Entry {
+        int64_t vruntime;
+        uint64_t sequence;
+        std::shared_ptr<Thread> thread;
+
+        bool operator<(const Entry& other) const {
+            return vruntime < other.vruntime || (vruntime == other.vruntime && sequence < other.sequence);
+        }
+    };
+
+    std::set<Entry> timeline;
+
+    uint64_t next_sequence = 0;
+
+    // The sum of the weights of the threads in the timeline
+    int64_t total_weight = 0;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    CFSScheduler(int slice = -1);
+
+    SchedulingDecision get_next_thread();
+
+    void add_to_ready_queue(std::shared_ptr<Thread> thread);
+
+    size_t size() const;
+
+    int get_weight(std::shared_ptr<Thread> thread);
+
+    int64_t get_vruntime(std::shared_ptr<Thread> thread);
+
+};
+
+#endif
@@ -0,0 +1,74 @@
+#include "algorithms/edf/edf_algorithm.hpp"
+
+#include <cassert>
+#include <climits>
+#include <stdexcept>
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+EDFScheduler::EDFScheduler(int slice)
+{
+    if (slice != -1)
+    {
+        throw("EDF does NOT take a customizable time slice");
+    }
+}
+
+SchedulingDecision EDFScheduler::get_next_thread()
+{
+    if (priorityQueue.empty())
+    {
+        SchedulingDecision emptyDecision;
+        emptyDecision.explain("No threads available for scheduling.");
+        emptyDecision.thread = nullptr;
+        emptyDecision.time_slice = -1;
+
+        return emptyDecision;
+    }
+
+    int num_ready = priorityQueue.size();
+    std::shared_ptr<Thread> nextThread = priorityQueue.top();
+    priorityQueue.pop();
+
+    int key = get_key(nextThread);
+
+    SchedulingDecision decision;
+    decision.thread = nextThread;
+    decision.time_slice = -1;
+    decision.explain("Selected from {} threads ({} = {}). Will run to completion of burst.",
+                     num_ready, key_name(nextThread), key == INT_MAX ? -1 : key);
+
+    return decision;
+}
+
+void EDFScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread)
+{
+    priorityQueue.push(get_key(thread), thread);
+}
+
+size_t EDFScheduler::size() const
+{
+    return priorityQueue.size();
+}
+
+// A thread preempts the running thread if it would have been chosen over it
+bool EDFScheduler::should_preempt(std::shared_ptr<Thread> running, std::shared_ptr<Thread> arriving)
+{
+    return get_key(arriving) < get_key(running);
+}
+
+bool EDFScheduler::should_preempt_first(std::shared_ptr<Thread> running, std::shared_ptr<Thread> other)
+{
+    return get_key(running) > get_key(other);
+}
+
+int EDFScheduler::get_key(std::shared_ptr<Thread> thread)
+{
+    return thread->deadline() == -1 ? INT_MAX : thread->deadline();
+}
+
+const char* EDFScheduler::key_name(std::shared_ptr<Thread> thread) const
+{
+    return "deadline";
+}
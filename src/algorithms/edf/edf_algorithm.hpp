@@ -0,0 +1,57 @@
+#ifndef EDF_ALGORITHM_HPP
+#define EDF_ALGORITHM_HPP
+
+#include <memory>
+#include "algorithms/scheduling_algorithm.hpp"
+#include "utilities/stable_priority_queue/stable_priority_queue.hpp"
+
+/*
+    EDFScheduler:
+        A representation of earliest-deadline-first scheduling.
+
+        The ready thread with the earliest deadline (its arrival time plus the deadline from
+        the simulation file) runs next, to the completion of its burst unless a thread with an
+        earlier deadline becomes ready and preempts it. Threads without a deadline only run
+        when no thread with one is ready. Threads with the same deadline run in the order
+        they became ready.
+
+        Subclasses can order threads by something else by overriding get_key().
+*/
+
+class EDFScheduler : public Scheduler {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    EDFScheduler(int slice = -1);
+
+    SchedulingDecision get_next_thread();
+
+    void add_to_ready_queue(std::shared_ptr<Thread> thread);
+
+    size_t size() const;
+
+    bool should_preempt(std::shared_ptr<Thread> running, std::shared_ptr<Thread> arriving);
+
+    bool should_preempt_first(std::shared_ptr<Thread> running, std::shared_ptr<Thread> other);
+
+    Stable_Priority_Queue<std::shared_ptr<Thread>> priorityQueue;
+
+    /*
+        get_key(thread):
+            The value threads are ordered by, lowest first. For EDF this is the thread's
+            deadline, or INT_MAX if it has none.
+    */
+    virtual int get_key(std::shared_ptr<Thread> thread);
+
+    /*
+        key_name(thread):
+            What get_key() returns for the thread, for explaining decisions.
+    */
+    virtual const char* key_name(std::shared_ptr<Thread> thread) const;
+
+};
+
+#endif
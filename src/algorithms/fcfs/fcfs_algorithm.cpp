@@ -23,27 +23,27 @@ FCFSScheduler::FCFSScheduler(int slice)
 }
 
 // Gets the next thread based on FCFS
-std::shared_ptr<SchedulingDecision> FCFSScheduler::get_next_thread()
+SchedulingDecision FCFSScheduler::get_next_thread()
 {
     if (readyQueue.empty())
     {
         SchedulingDecision emptyDecision;
-        emptyDecision.explanation = "No threads available for scheduling.";
+        emptyDecision.explain("No threads available for scheduling.");
         emptyDecision.thread = nullptr;
         emptyDecision.time_slice = -1;
 
-        return std::make_shared<SchedulingDecision>(emptyDecision);
+        return emptyDecision;
     }
 
     std::shared_ptr<Thread> nextThread = readyQueue.front();
     readyQueue.pop();
 
     SchedulingDecision decision;
-    decision.explanation = "Selected from " + std::to_string(get_num_ready_threads()) + " threads. Will run to completion of burst.";
+    decision.explain("Selected from {} threads. Will run to completion of burst.", get_num_ready_threads());
     decision.thread = nextThread;
     decision.time_slice = -1;
 
-    return std::make_shared<SchedulingDecision>(decision);
+    return decision;
 }
 
 // Adds a thread to the queue
@@ -58,19 +58,21 @@ size_t FCFSScheduler::size() const
     return readyQueue.size();
 }
 
-// Gets the number of ready threads in the queue
-int FCFSScheduler::get_num_ready_threads()
+// Lists the queue from front to back
+std::vector<std::shared_ptr<Thread>> FCFSScheduler::ready_threads() const
 {
-    int readyCount = 0;
-    std::queue<std::shared_ptr<Thread>> tempQueue = readyQueue;
-    while (!tempQueue.empty())
+    std::vector<std::shared_ptr<Thread>> threads;
+    for (auto queue = readyQueue; !queue.empty(); queue.pop())
     {
-        std::shared_ptr<Thread> thread = tempQueue.front();
-        tempQueue.pop();
-        if (thread->current_state == ThreadState::READY)
-        {
-            readyCount++;
-        }
+        threads.push_back(queue.front());
     }
-    return readyCount + 1;
+    return threads;
+}
+
+// Gets the number of ready threads in the queue
+int FCFSScheduler::get_num_ready_threads()
+{
+    // Only READY threads are ever queued, so there is no need to walk the queue: count the
+    // queued threads plus the one that was just taken off it.
+    return readyQueue.size() + 1;
 }
@@ -2,6 +2,8 @@
 #define FCFS_ALGORITHM_HPP
 
 #include <memory>
+#include <queue>
+#include <vector>
 #include "algorithms/scheduling_algorithm.hpp"
 
 /*
@@ -14,7 +16,7 @@
         feel are helpful for implementing the algorithm.
 */
 
-class FCFSScheduler : public Scheduler {
+class FCFSScheduler final : public Scheduler {
 public:
 
     //==================================================
@@ -33,12 +35,14 @@ public:
 
     FCFSScheduler(int slice = -1);
 
-    std::shared_ptr<SchedulingDecision> get_next_thread();
+    SchedulingDecision get_next_thread();
 
     void add_to_ready_queue(std::shared_ptr<Thread> thread);
 
     size_t size() const;
 
+    std::vector<std::shared_ptr<Thread>> ready_threads() const;
+
 
 
 
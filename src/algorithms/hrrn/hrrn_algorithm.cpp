@@ -0,0 +1,63 @@
+#include "algorithms/hrrn/hrrn_algorithm.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+HRRNScheduler::HRRNScheduler(int slice, bool oracle) : oracle(oracle)
+{
+    if (slice != -1)
+    {
+        throw("HRRN does NOT take a customizable time slice");
+    }
+}
+
+SchedulingDecision HRRNScheduler::get_next_thread()
+{
+    if (priorityQueue.empty())
+    {
+        SchedulingDecision emptyDecision;
+        emptyDecision.explain("No threads available for scheduling.");
+        emptyDecision.thread = nullptr;
+        emptyDecision.time_slice = -1;
+
+        return emptyDecision;
+    }
+
+    priorityQueue.advance(current_time);
+
+    int num_ready = priorityQueue.size();
+    std::shared_ptr<Thread> nextThread = priorityQueue.top();
+    priorityQueue.pop();
+
+    // The response ratio is (waiting + burst) / burst, but explanations only take integers
+    SchedulingDecision decision;
+    decision.thread = nextThread;
+    decision.time_slice = -1;
+    decision.explain("Selected from {} threads (waiting time = {}, {} = {}). Will run to completion of burst.",
+                     num_ready, int(current_time) - nextThread->state_change_time,
+                     oracle ? "burst" : "estimated burst", expected_burst(nextThread));
+
+    return decision;
+}
+
+void HRRNScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread)
+{
+    // The thread has been waiting since it became ready, which may be before now if it was moved
+    // here from another run queue
+    priorityQueue.advance(current_time);
+    priorityQueue.push(thread->state_change_time, expected_burst(thread), thread);
+}
+
+size_t HRRNScheduler::size() const
+{
+    return priorityQueue.size();
+}
+
+int HRRNScheduler::expected_burst(std::shared_ptr<Thread> thread) const
+{
+    return std::max(1, oracle ? thread->peek_next_burst(CPU) : thread->estimated_remaining_time());
+}
@@ -0,0 +1,59 @@
+#ifndef HRRN_ALGORITHM_HPP
+#define HRRN_ALGORITHM_HPP
+
+#include <memory>
+#include "algorithms/scheduling_algorithm.hpp"
+#include "utilities/kinetic_priority_queue/kinetic_priority_queue.hpp"
+
+/*
+    HRRNScheduler:
+        A representation of highest-response-ratio-next scheduling.
+
+        The ready thread with the highest response ratio, (waiting time + expected burst) /
+        expected burst, runs next, to the completion of its burst. Short bursts are favored
+        like in SPN, but a thread's ratio keeps growing while it waits, so long bursts do not
+        starve. Threads with the same ratio run in the order they became ready.
+
+        Since the ratios change with time, the ready queue is a Kinetic_Priority_Queue, which
+        only reorders the threads whose ratios have overtaken each other instead of
+        recomputing every ratio on each dispatch.
+
+        Like SRTScheduler, it uses the thread's burst_estimate unless it is the oracle variant.
+*/
+
+class HRRNScheduler : public Scheduler {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        oracle:
+            Whether the scheduler uses the actual burst lengths instead of the estimates.
+    */
+    bool oracle = false;
+
+    Kinetic_Priority_Queue<std::shared_ptr<Thread>> priorityQueue;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    HRRNScheduler(int slice = -1, bool oracle = false);
+
+    SchedulingDecision get_next_thread();
+
+    void add_to_ready_queue(std::shared_ptr<Thread> thread);
+
+    size_t size() const;
+
+    /*
+        expected_burst(thread):
+            The length of the thread's next CPU burst, or the estimate of it.
+    */
+    int expected_burst(std::shared_ptr<Thread> thread) const;
+
+};
+
+#endif
@@ -0,0 +1,82 @@
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "algorithms/hrrn/hrrn_algorithm.hpp"
+#include "utilities/benchmark/benchmark.hpp"
+
+/*
+    Measures HRRN dispatches as the number of ready threads grows. Every dispatch takes the
+    thread with the highest response ratio and puts it back as if it had become ready again.
+
+    For reference, it also times what the obvious implementation does: scan every ready thread
+    and recompute its ratio on each dispatch.
+*/
+
+namespace {
+
+const int OPERATIONS = 50000;
+
+struct Ready {
+    int64_t ready_time;
+    int64_t burst;
+};
+
+}
+
+BENCHMARK(hrrn_dispatch) {
+    for (int num_threads : {100, 1000, 10000}) {
+        std::vector<std::shared_ptr<Thread>> threads;
+        for (int thread_id = 0; thread_id < num_threads; ++thread_id) {
+            auto thread = std::make_shared<Thread>(0, thread_id, 0, NORMAL);
+            thread->burst_estimate = 1 + (thread_id * 7919) % 500;
+            thread->state_change_time = 0;
+            threads.push_back(thread);
+        }
+
+        int64_t checksum = 0;
+        double kinetic_seconds = time_best_of(3, [&] {
+            HRRNScheduler scheduler;
+            for (const auto& thread : threads) {
+                scheduler.add_to_ready_queue(thread);
+            }
+            for (int operation = 0; operation < OPERATIONS; ++operation) {
+                scheduler.current_time = operation;
+                auto thread = scheduler.get_next_thread().thread;
+                checksum += thread->thread_id;
+                thread->state_change_time = operation;
+                scheduler.add_to_ready_queue(thread);
+            }
+        });
+
+        double scan_seconds = time_best_of(3, [&] {
+            std::vector<Ready> ready;
+            for (const auto& thread : threads) {
+                ready.push_back({0, thread->burst_estimate});
+            }
+            for (int operation = 0; operation < OPERATIONS; ++operation) {
+                size_t best = 0;
+                double best_ratio = -1;
+                for (size_t index = 0; index < ready.size(); ++index) {
+                    double ratio = double(operation - ready[index].ready_time + ready[index].burst) / ready[index].burst;
+                    if (ratio > best_ratio) {
+                        best = index;
+                        best_ratio = ratio;
+                    }
+                }
+                checksum += best;
+                ready[best].ready_time = operation;
+            }
+        });
+
+        // Using the result keeps the loops from being optimized away
+        if (checksum == 0) {
+            throw std::logic_error("HRRN dispatched no threads.");
+        }
+
+        std::string threads_label = std::to_string(num_threads) + " threads, ";
+        report(threads_label + "kinetic tournament", kinetic_seconds, OPERATIONS, "dispatches");
+        report(threads_label + "linear scan", scan_seconds, OPERATIONS, "dispatches");
+    }
+}
@@ -0,0 +1,115 @@
+#include "algorithms/lottery/lottery_algorithm.hpp"
+
+#include <cassert>
+#include <stdexcept>
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+LotteryScheduler::LotteryScheduler(int slice, uint64_t seed) : random_state(seed)
+{
+    if (slice == -1)
+    {
+        time_slice = 3;
+    }
+    else
+    {
+        time_slice = slice;
+    }
+}
+
+SchedulingDecision LotteryScheduler::get_next_thread()
+{
+    if (size() == 0)
+    {
+        SchedulingDecision emptyDecision;
+        emptyDecision.explain("No threads available for scheduling.");
+        emptyDecision.thread = nullptr;
+        emptyDecision.time_slice = -1;
+
+        return emptyDecision;
+    }
+
+    int num_ready = size();
+    int64_t total = tickets.total();
+    int64_t ticket = draw(total);
+    size_t slot = tickets.find(ticket);
+
+    std::shared_ptr<Thread> nextThread = std::move(slots[slot]);
+    tickets.set(slot, 0);
+    free_slots.push_back(slot);
+    shares.dispatched(*nextThread);
+    shares.remove(*nextThread);
+
+    SchedulingDecision decision;
+    decision.thread = nextThread;
+    decision.time_slice = time_slice;
+    decision.explain("Selected from {} threads (ticket {} of {}). Will run for at most {} ticks.",
+                     num_ready, ticket, total, time_slice);
+
+    return decision;
+}
+
+void LotteryScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread)
+{
+    if (free_slots.empty())
+    {
+        size_t old_size = slots.size();
+        slots.resize(old_size == 0 ? 8 : old_size * 2);
+        tickets.resize(slots.size());
+        for (size_t slot = slots.size(); slot-- > old_size;)
+        {
+            free_slots.push_back(slot);
+        }
+    }
+
+    size_t slot = free_slots.back();
+    free_slots.pop_back();
+    slots[slot] = thread;
+    tickets.set(slot, thread->ticket_count());
+    shares.add(*thread);
+}
+
+std::shared_ptr<Thread> LotteryScheduler::steal_thread()
+{
+    if (size() == 0)
+    {
+        return nullptr;
+    }
+
+    size_t slot = tickets.find(tickets.total() - 1);
+    std::shared_ptr<Thread> thread = std::move(slots[slot]);
+    tickets.set(slot, 0);
+    free_slots.push_back(slot);
+    shares.remove(*thread);
+    return thread;
+}
+
+size_t LotteryScheduler::size() const
+{
+    return slots.size() - free_slots.size();
+}
+
+void LotteryScheduler::report_stats(SystemStats& stats) const
+{
+    shares.report(stats);
+}
+
+uint64_t LotteryScheduler::draw(uint64_t bound)
+{
+    // Numbers below the threshold would make the low results slightly more likely
+    uint64_t threshold = -bound % bound;
+    while (true)
+    {
+        // splitmix64
+        uint64_t random = (random_state += 0x9e3779b97f4a7c15);
+        random = (random ^ (random >> 30)) * 0xbf58476d1ce4e5b9;
+        random = (random ^ (random >> 27)) * 0x94d049bb133111eb;
+        random ^= random >> 31;
+
+        if (random >= threshold)
+        {
+            return random % bound;
+        }
+    }
+}
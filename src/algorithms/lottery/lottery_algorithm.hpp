@@ -0,0 +1,70 @@
+#ifndef LOTTERY_ALGORITHM_HPP
+#define LOTTERY_ALGORITHM_HPP
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "algorithms/scheduling_algorithm.hpp"
+#include "algorithms/share_tracker.hpp"
+#include "utilities/fenwick_tree/fenwick_tree.hpp"
+
+/*
+    LotteryScheduler:
+        A representation of lottery scheduling, a proportional-share algorithm.
+
+        Every ready thread holds its ticket_count() tickets, and each dispatch draws one of
+        the tickets at random; its holder runs for at most one time slice. Over time each
+        thread gets a share of the CPU proportional to its tickets.
+
+        The tickets are kept in a Fenwick tree indexed by slot, so a draw and the insertion or
+        removal of a thread take O(log n) time. The random numbers come from a splitmix64
+        generator seeded in the constructor, so the same seed always gives the same schedule
+        on every platform.
+*/
+
+class LotteryScheduler : public Scheduler {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    static const uint64_t DEFAULT_SEED = 1;
+
+    // The tickets of the thread in each slot, which is 0 for a free slot
+    Fenwick_Tree tickets;
+
+    std::vector<std::shared_ptr<Thread>> slots;
+
+    std::vector<size_t> free_slots;
+
+    uint64_t random_state;
+
+    ShareTracker shares;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    LotteryScheduler(int slice = -1, uint64_t seed = DEFAULT_SEED);
+
+    SchedulingDecision get_next_thread();
+
+    void add_to_ready_queue(std::shared_ptr<Thread> thread);
+
+    size_t size() const;
+
+    // Takes the holder of the last ticket, so moving a thread draws nothing and is not counted as a dispatch
+    std::shared_ptr<Thread> steal_thread();
+
+    void report_stats(SystemStats& stats) const;
+
+    /*
+        draw(bound):
+            Returns a random number from 0 up to bound - 1, without modulo bias.
+    */
+    uint64_t draw(uint64_t bound);
+
+};
+
+#endif
@@ -1,58 +1,82 @@
 #include "algorithms/mlfq/mlfq_algorithm.hpp"
 
 #include <cassert>
+#include <climits>
 #include <stdexcept>
+#include <string>
 
 #define FMT_HEADER_ONLY
 #include "utilities/fmt/format.h"
-#include "utilities/stable_priority_queue/stable_priority_queue.hpp"
 
 /*
     Here is where you should define the logic for the MLFQ algorithm.
 */
 
-MLFQScheduler::MLFQScheduler(int slice)
+MLFQScheduler::MLFQScheduler(int slice, int num_levels)
 {
     if (slice != -1)
     {
         throw("MLFQ does NOT take a customizable time slice");
     }
-    for (int i = 0; i < 10; i++) {
-        queues.push_back(Stable_Priority_Queue<std::shared_ptr<Thread>>());
+    if (num_levels <= 0 || num_levels > MAX_LEVELS)
+    {
+        throw std::invalid_argument("MLFQ must have between 1 and " + std::to_string(MAX_LEVELS) + " levels.");
+    }
+    for (int i = 0; i < num_levels; i++) {
+        // 2^i, held at the largest int for the deepest levels
+        quanta.push_back(i < 31 ? 1 << i : INT_MAX);
+        queues.push_back(MLFQQueue());
     }
 }
 
-std::shared_ptr<SchedulingDecision> MLFQScheduler::get_next_thread()
+MLFQScheduler::MLFQScheduler(const std::vector<int>& quanta) : quanta(quanta)
 {
-    int index = 0;
-
-    while (queues.at(index).empty())
+    if (quanta.empty() || quanta.size() > MAX_LEVELS)
+    {
+        throw std::invalid_argument("MLFQ must have between 1 and " + std::to_string(MAX_LEVELS) + " levels.");
+    }
+    for (int quantum : quanta)
     {
-        index++;
-        if (index > 9)
+        if (quantum <= 0)
         {
-            SchedulingDecision emptyDecision;
-            emptyDecision.explanation = "No threads available for scheduling.";
-            emptyDecision.thread = nullptr;
-            emptyDecision.time_slice = -1;
-
-            return std::make_shared<SchedulingDecision>(emptyDecision);
+            throw std::invalid_argument("MLFQ quanta must be greater than zero.");
         }
+        queues.push_back(MLFQQueue());
+    }
+}
+
+SchedulingDecision MLFQScheduler::get_next_thread()
+{
+    if (occupied == 0)
+    {
+        SchedulingDecision emptyDecision;
+        emptyDecision.explain("No threads available for scheduling.");
+        emptyDecision.thread = nullptr;
+        emptyDecision.time_slice = -1;
+
+        return emptyDecision;
+    }
+
+    int index = __builtin_ctzll(occupied);
+    MLFQQueue& queue = queues[index];
+    std::shared_ptr<Thread> nextThread = queue.top();
+    queue.pop();
+    if (queue.empty())
+    {
+        occupied &= ~(uint64_t(1) << index);
     }
-    std::shared_ptr<Thread> nextThread = queues.at(index).top();
-    queues.at(index).pop();
+    num_ready--;
 
     SchedulingDecision decision;
     decision.thread = nextThread;
     nextThread->prev_service_time = nextThread->service_time;
     nextThread->last_queue_level = index;
-    this->time_slice = std::pow(2, index);
+    this->time_slice = quanta[index];
     decision.time_slice = -1;
-    decision.explanation = "Selected from queue " + std::to_string(index) + " (priority = " + 
-                            get_priority_str(nextThread) + ", runtime = " + std::to_string(nextThread->mlfq_time) + 
-                            "). Will run for at most " + std::to_string(time_slice) + " ticks.";
+    decision.explain("Selected from queue {} (priority = {}, runtime = {}). Will run for at most {} ticks.",
+                     index, get_priority_str(nextThread), nextThread->mlfq_time, time_slice);
 
-    return std::make_shared<SchedulingDecision>(decision);
+    return decision;
 
 }
 
@@ -60,28 +84,53 @@ void MLFQScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread)
 {
     if (thread->last_queue_level == -1) {
         thread->last_queue_level = 0;
-        queues.at(thread->last_queue_level).push(get_priority(thread), thread);
-        return;
-    }
-    thread->mlfq_time += thread->service_time - thread->prev_service_time;
-    if (thread->mlfq_time >= std::pow(2, thread->last_queue_level)) {
-        thread->last_queue_level += 1;
-        thread->mlfq_time = 0;
+    } else {
+        thread->mlfq_time += thread->service_time - thread->prev_service_time;
+        if (thread->mlfq_time >= quanta[thread->last_queue_level] && thread->last_queue_level + 1 < (int) queues.size()) {
+            thread->last_queue_level += 1;
+            thread->mlfq_time = 0;
+        }
     }
-    queues.at(thread->last_queue_level).push(get_priority(thread), thread);
+    int level = thread->last_queue_level;
+    queues[level].push(get_priority(thread), thread);
+    occupied |= uint64_t(1) << level;
+    num_ready++;
 }
 
 
 size_t MLFQScheduler::size() const
 {
-    int size = 0;
-    for (int i = 0; i < (int) queues.size(); i++)
+    return num_ready;
+}
+
+
+std::vector<std::shared_ptr<Thread>> MLFQScheduler::ready_threads() const
+{
+    std::vector<std::shared_ptr<Thread>> threads;
+    for (const MLFQQueue& level : queues)
     {
-        size += queues.at(i).size();
+        for (auto queue = level; !queue.empty(); queue.pop())
+        {
+            threads.push_back(queue.top());
+        }
     }
-    return size;
+    return threads;
 }
 
+void MLFQScheduler::restore_ready_threads(const std::vector<std::shared_ptr<Thread>>& threads)
+{
+    for (const auto& thread : threads)
+    {
+        int level = thread->last_queue_level;
+        if (level < 0 || level >= (int) queues.size())
+        {
+            throw std::invalid_argument("A restored thread is in an MLFQ level that does not exist.");
+        }
+        queues[level].push(get_priority(thread), thread);
+        occupied |= uint64_t(1) << level;
+        num_ready++;
+    }
+}
 
 int MLFQScheduler::get_priority(std::shared_ptr<Thread> thread)
 {
@@ -100,7 +149,7 @@ int MLFQScheduler::get_priority(std::shared_ptr<Thread> thread)
     }
 }
 
-std::string MLFQScheduler::get_priority_str(std::shared_ptr<Thread> thread) {
+const char* MLFQScheduler::get_priority_str(std::shared_ptr<Thread> thread) {
     switch (thread->priority)
     {
     case ProcessPriority::SYSTEM:
@@ -1,11 +1,13 @@
 #ifndef MFLQ_ALGORITHM_HPP
 #define MFLQ_ALGORITHM_HPP
 
+#include <cstdint>
 #include <map>
 #include <utility>
 #include <memory>
+#include <vector>
 #include "algorithms/scheduling_algorithm.hpp"
-#include "utilities/stable_priority_queue/stable_priority_queue.hpp"
+#include "utilities/bucket_priority_queue/bucket_priority_queue.hpp"
 
 /*
     MLFQScheduler:
@@ -13,40 +15,68 @@
 
         You are free to add any member functions or member variables that you
         feel are helpful for implementing the algorithm.
+
+        Threads start in level 0 and move down a level each time they use up the level's
+        quantum, staying in the last level once they reach it. The number of levels (up to
+        MAX_LEVELS) and their quanta can be chosen when the scheduler is created; by default
+        there are 10 levels, and level i has a quantum of 2^i ticks.
+
+        A bitmask records which levels have threads in them, so the highest non-empty level
+        is found with a single count-trailing-zeros instruction however many levels there are.
 */
 
 
-//using MLFQQueue = Stable_Priority_Queue<std::shared_ptr<Thread>>;
+// One queue per level, ordered by the four priority classes
+using MLFQQueue = Bucket_Priority_Queue<std::shared_ptr<Thread>, 4>;
 
-class MLFQScheduler : public Scheduler {
+class MLFQScheduler final : public Scheduler {
 public:
     
     //==================================================
     //  Member variables
     //==================================================
 
-    // TODO: Add any member variables you may need.
+    static const int DEFAULT_LEVELS = 10;
+    static const int MAX_LEVELS = 64;
+
+    // quanta[i] is how many ticks a thread may run in level i before it is moved down
+    std::vector<int> quanta;
+
+    std::vector<MLFQQueue> queues;
+
+    // Bit i is set when queues[i] is not empty
+    uint64_t occupied = 0;
+
+    // The number of threads across all of the queues
+    size_t num_ready = 0;
 
     //==================================================
     //  Member functions
     //==================================================
 
-    MLFQScheduler(int slice = -1);
+    MLFQScheduler(int slice = -1, int num_levels = DEFAULT_LEVELS);
 
-    std::shared_ptr<SchedulingDecision> get_next_thread();
+    // One level per entry in quanta, each of which must be positive
+    MLFQScheduler(const std::vector<int>& quanta);
+
+    SchedulingDecision get_next_thread();
 
     void add_to_ready_queue(std::shared_ptr<Thread> thread);
 
     size_t size() const;
 
-    std::vector<Stable_Priority_Queue<std::shared_ptr<Thread>>> queues;
+    // The levels from highest to lowest, each in the order it would be popped
+    std::vector<std::shared_ptr<Thread>> ready_threads() const;
+
+    // Puts each thread back in the level it was in, without charging its run time again
+    void restore_ready_threads(const std::vector<std::shared_ptr<Thread>>& threads);
 
     // key is (processId, threadId)
     //std::map<std::pair<int, int>, int> threadMap;
 
     int get_priority(std::shared_ptr<Thread> thread);
 
-    std::string get_priority_str(std::shared_ptr<Thread> thread);
+    const char* get_priority_str(std::shared_ptr<Thread> thread);
 
 };
 
@@ -0,0 +1,52 @@
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "algorithms/mlfq/mlfq_algorithm.hpp"
+#include "utilities/benchmark/benchmark.hpp"
+
+/*
+    Measures MLFQ dispatches with every thread in the last level, which is where the old
+    linear scan over the levels was slowest, for the default 10 levels and for 64.
+*/
+
+namespace {
+
+const int NUM_THREADS = 1000;
+const int OPERATIONS = 1000000;
+
+double time_mlfq(int num_levels) {
+    std::vector<std::shared_ptr<Thread>> threads;
+    for (int thread_id = 0; thread_id < NUM_THREADS; ++thread_id) {
+        auto thread = std::make_shared<Thread>(0, thread_id, 0, ProcessPriority(thread_id % 4));
+        thread->last_queue_level = num_levels - 1;
+        threads.push_back(thread);
+    }
+
+    size_t dispatched = 0;
+    double seconds = time_best_of(5, [&] {
+        MLFQScheduler scheduler(-1, num_levels);
+        for (const auto& thread : threads) {
+            scheduler.add_to_ready_queue(thread);
+        }
+        for (int operation = 0; operation < OPERATIONS; ++operation) {
+            auto thread = scheduler.get_next_thread().thread;
+            dispatched += scheduler.size();
+            scheduler.add_to_ready_queue(thread);
+        }
+    });
+
+    // Using the result keeps the loop from being optimized away
+    if (dispatched == 0) {
+        throw std::logic_error("MLFQ had no threads to dispatch.");
+    }
+
+    return seconds;
+}
+
+}
+
+BENCHMARK(mlfq_dispatch) {
+    report("10 levels", time_mlfq(10), OPERATIONS, "dispatches");
+    report("64 levels", time_mlfq(64), OPERATIONS, "dispatches");
+}
@@ -0,0 +1,185 @@
+#include "algorithms/per_cpu/per_cpu_algorithm.hpp"
+
+#include <stdexcept>
+
+#include "algorithms/scheduler_factory.hpp"
+
+PerCPUScheduler::PerCPUScheduler(const std::string& algorithm, int slice, int num_cpus, bool idle_steal, int rebalance_interval,
+                                 int mlfq_levels, const std::vector<int>& mlfq_quanta) :
+    idle_steal(idle_steal), rebalance_interval(rebalance_interval)
+{
+    if (num_cpus <= 0)
+    {
+        throw std::invalid_argument("There must be at least one CPU.");
+    }
+    for (int cpu = 0; cpu < num_cpus; cpu++)
+    {
+        run_queues.push_back(make_scheduler(algorithm, slice, mlfq_levels, mlfq_quanta));
+    }
+    time_slice = run_queues.front()->time_slice;
+}
+
+SchedulingDecision PerCPUScheduler::get_next_thread()
+{
+    return get_next_thread_for(0);
+}
+
+SchedulingDecision PerCPUScheduler::get_next_thread_for(int cpu)
+{
+    if (rebalance_interval > 0 && current_time >= next_rebalance)
+    {
+        rebalance();
+        next_rebalance = (current_time / rebalance_interval + 1) * rebalance_interval;
+    }
+
+    int victim = -1;
+    if (idle_steal && run_queues[cpu]->empty())
+    {
+        victim = longest_queue(cpu);
+        if (victim != -1)
+        {
+            move_thread(victim, cpu);
+            steals++;
+        }
+    }
+
+    std::shared_ptr<Scheduler> run_queue = run_queues[cpu];
+    run_queue->current_time = current_time;
+
+    auto decision = run_queue->get_next_thread();
+    time_slice = run_queue->time_slice;
+
+    decision.stolen_from = victim;
+
+    return decision;
+}
+
+int PerCPUScheduler::select_cpu(std::shared_ptr<Thread> thread, const std::vector<int>& idle_cpus)
+{
+    for (int cpu : idle_cpus)
+    {
+        if (cpu == thread->run_queue)
+        {
+            return cpu;
+        }
+    }
+    return Scheduler::select_cpu(thread, idle_cpus);
+}
+
+void PerCPUScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread)
+{
+    int cpu = (thread->last_cpu != -1) ? thread->last_cpu : shortest_queue();
+
+    thread->run_queue = cpu;
+    run_queues[cpu]->current_time = current_time;
+    run_queues[cpu]->add_to_ready_queue(thread);
+}
+
+bool PerCPUScheduler::should_preempt(std::shared_ptr<Thread> running, std::shared_ptr<Thread> arriving)
+{
+    // Only the CPU whose run queue the arriving thread joined would dispatch it
+    int cpu = arriving->run_queue;
+    return running->last_cpu == cpu && run_queues[cpu]->should_preempt(running, arriving);
+}
+
+bool PerCPUScheduler::dispatch_when_empty() const
+{
+    return rebalance_interval > 0;
+}
+
+std::shared_ptr<Thread> PerCPUScheduler::steal_thread()
+{
+    int victim = longest_queue(-1);
+    if (victim == -1)
+    {
+        return nullptr;
+    }
+    return run_queues[victim]->steal_thread();
+}
+
+void PerCPUScheduler::take_woken_cpus(std::vector<int>& cpus)
+{
+    cpus.insert(cpus.end(), rebalanced_to.begin(), rebalanced_to.end());
+    rebalanced_to.clear();
+}
+
+void PerCPUScheduler::report_stats(SystemStats& stats) const
+{
+    stats.steals += steals;
+    stats.rebalance_moves += rebalance_moves;
+    for (const auto& run_queue : run_queues)
+    {
+        run_queue->report_stats(stats);
+    }
+}
+
+size_t PerCPUScheduler::size() const
+{
+    size_t size = 0;
+    for (const auto& run_queue : run_queues)
+    {
+        size += run_queue->size();
+    }
+    return size;
+}
+
+int PerCPUScheduler::longest_queue(int exclude) const
+{
+    int longest = -1;
+    for (int cpu = 0; cpu < (int) run_queues.size(); cpu++)
+    {
+        if (cpu == exclude || run_queues[cpu]->empty())
+        {
+            continue;
+        }
+        if (longest == -1 || run_queues[cpu]->size() > run_queues[longest]->size())
+        {
+            longest = cpu;
+        }
+    }
+    return longest;
+}
+
+int PerCPUScheduler::shortest_queue() const
+{
+    int shortest = 0;
+    for (int cpu = 1; cpu < (int) run_queues.size(); cpu++)
+    {
+        if (run_queues[cpu]->size() < run_queues[shortest]->size())
+        {
+            shortest = cpu;
+        }
+    }
+    return shortest;
+}
+
+void PerCPUScheduler::rebalance()
+{
+    while (true)
+    {
+        int longest = longest_queue(-1);
+        int shortest = shortest_queue();
+        if (longest == -1 || run_queues[longest]->size() <= run_queues[shortest]->size() + 1)
+        {
+            return;
+        }
+        move_thread(longest, shortest);
+        rebalanced_to.push_back(shortest);
+        rebalance_moves++;
+    }
+}
+
+bool PerCPUScheduler::move_thread(int from, int to)
+{
+    run_queues[from]->current_time = current_time;
+    std::shared_ptr<Thread> thread = run_queues[from]->steal_thread();
+    if (!thread)
+    {
+        return false;
+    }
+
+    thread->run_queue = to;
+    run_queues[to]->current_time = current_time;
+    run_queues[to]->add_to_ready_queue(thread);
+    return true;
+}
@@ -0,0 +1,125 @@
+#ifndef PER_CPU_ALGORITHM_HPP
+#define PER_CPU_ALGORITHM_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "algorithms/scheduling_algorithm.hpp"
+
+/*
+    PerCPUScheduler:
+        Gives each simulated CPU its own run queue, each one a separate instance of one of the
+        other algorithms, instead of having every CPU share a single ready queue.
+
+        A thread that becomes ready goes back to the run queue of the CPU it last ran on, so it
+        keeps its cache affinity, and new threads go to the shortest run queue. Load is balanced
+        between the run queues in two optional ways:
+            Idle stealing: a CPU whose run queue is empty takes a thread from the longest one.
+            Periodic rebalancing: every so many ticks, threads are moved from the longest run
+            queues to the shortest ones until their lengths differ by at most one.
+
+        This is a derived class from the base scheduling algorithm class.
+*/
+
+class PerCPUScheduler : public Scheduler {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        run_queues:
+            One scheduler per CPU, indexed by CPU.
+    */
+    std::vector<std::shared_ptr<Scheduler>> run_queues;
+
+    /*
+        idle_steal:
+            Whether a CPU with an empty run queue steals from the longest one.
+    */
+    bool idle_steal;
+
+    /*
+        rebalance_interval:
+            How often (in ticks) to rebalance the run queues, or 0 to never rebalance.
+    */
+    int rebalance_interval;
+
+    /*
+        next_rebalance:
+            The time at or after which the run queues are next rebalanced.
+    */
+    unsigned int next_rebalance = 0;
+
+    /*
+        steals / rebalance_moves:
+            How many threads were moved by idle stealing and by rebalancing.
+    */
+    size_t steals = 0;
+    size_t rebalance_moves = 0;
+
+    /*
+        rebalanced_to:
+            The run queues that rebalancing has moved threads to since take_woken_cpus() was
+            last called. May hold the same CPU more than once.
+    */
+    std::vector<int> rebalanced_to;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        PerCPUScheduler(algorithm, slice, num_cpus, idle_steal, rebalance_interval, mlfq_levels, mlfq_quanta):
+            Creates one run queue per CPU using the named algorithm and time slice, and the
+            MLFQ levels and quanta if the algorithm is MLFQ (see make_scheduler()).
+    */
+    PerCPUScheduler(const std::string& algorithm, int slice, int num_cpus, bool idle_steal, int rebalance_interval,
+                    int mlfq_levels = 0, const std::vector<int>& mlfq_quanta = {});
+
+    SchedulingDecision get_next_thread();
+
+    SchedulingDecision get_next_thread_for(int cpu);
+
+    int select_cpu(std::shared_ptr<Thread> thread, const std::vector<int>& idle_cpus);
+
+    void add_to_ready_queue(std::shared_ptr<Thread> thread);
+
+    bool should_preempt(std::shared_ptr<Thread> running, std::shared_ptr<Thread> arriving);
+
+    // Periodic rebalancing is timed from the dispatches, so none can be skipped
+    bool dispatch_when_empty() const;
+
+    std::shared_ptr<Thread> steal_thread();
+
+    void take_woken_cpus(std::vector<int>& cpus);
+
+    void report_stats(SystemStats& stats) const;
+
+    size_t size() const;
+
+    /*
+        longest_queue(exclude) / shortest_queue():
+            Return the index of the longest (ignoring exclude) or shortest run queue. Ties go
+            to the lowest index. longest_queue returns -1 if every other run queue is empty.
+    */
+    int longest_queue(int exclude) const;
+
+    int shortest_queue() const;
+
+    /*
+        rebalance():
+            Moves threads from the longest run queues to the shortest ones until their
+            lengths differ by at most one, and remembers which run queues were given threads.
+    */
+    void rebalance();
+
+    /*
+        move_thread(from, to):
+            Moves one thread between run queues. Returns false if from was empty.
+    */
+    bool move_thread(int from, int to);
+};
+
+#endif
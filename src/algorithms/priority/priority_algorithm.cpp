@@ -11,46 +11,62 @@
     Here is where you should define the logic for the priority algorithm.
 */
 
-PRIORITYScheduler::PRIORITYScheduler(int slice) {
+PRIORITYScheduler::PRIORITYScheduler(int slice, bool preemptive) : preemptive(preemptive) {
     if (slice != -1) {
         throw("PRIORITY must have a timeslice of -1");
     }
 }
 
-std::shared_ptr<SchedulingDecision> PRIORITYScheduler::get_next_thread() {
+SchedulingDecision PRIORITYScheduler::get_next_thread() {
     if (priorityQueue.empty())
     {
         SchedulingDecision emptyDecision;
-        emptyDecision.explanation = "No threads available for scheduling.";
+        emptyDecision.explain("No threads available for scheduling.");
         emptyDecision.thread = nullptr;
         emptyDecision.time_slice = -1;
 
-        return std::make_shared<SchedulingDecision>(emptyDecision);
+        return emptyDecision;
     }
-    std::vector<int>*  before_nums = get_num_threads();
+    std::array<int, 4> before_nums = class_counts;
     std::shared_ptr<Thread> nextThread = priorityQueue.top();
     priorityQueue.pop();
+    class_counts[get_priority(nextThread)]--;
     SchedulingDecision decision;
-    std::vector<int>*  after_nums = get_num_threads();
-    decision.explanation = "[S: " + std::to_string((*before_nums)[0]) + " I: " + std::to_string((*before_nums)[1]) + 
-                            " N: " + std::to_string((*before_nums)[2]) + " B: " + std::to_string((*before_nums)[3]) + 
-                            "] -> [S: " + std::to_string((*after_nums)[0]) + " I: " + std::to_string((*after_nums)[1]) + 
-                            " N: " +std::to_string((*after_nums)[2]) + " B: " + std::to_string((*after_nums)[3]) + 
-                            "]. Will run to completion of burst.";
+    const std::array<int, 4>& after_nums = class_counts;
+    decision.explain("[S: {} I: {} N: {} B: {}] -> [S: {} I: {} N: {} B: {}]. Will run to completion of burst.",
+                     before_nums[0], before_nums[1], before_nums[2], before_nums[3],
+                     after_nums[0], after_nums[1], after_nums[2], after_nums[3]);
     decision.thread = nextThread;
     decision.time_slice = -1;
 
-    return std::make_shared<SchedulingDecision>(decision);
+    return decision;
 }
 
 void PRIORITYScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread) {
     priorityQueue.push(get_priority(thread), thread);
+    class_counts[get_priority(thread)]++;
 }
 
 size_t PRIORITYScheduler::size() const {
     return priorityQueue.size();
 }
 
+std::vector<std::shared_ptr<Thread>> PRIORITYScheduler::ready_threads() const {
+    std::vector<std::shared_ptr<Thread>> threads;
+    for (auto queue = priorityQueue; !queue.empty(); queue.pop()) {
+        threads.push_back(queue.top());
+    }
+    return threads;
+}
+
+bool PRIORITYScheduler::should_preempt(std::shared_ptr<Thread> running, std::shared_ptr<Thread> arriving) {
+    return preemptive && get_priority(arriving) < get_priority(running);
+}
+
+bool PRIORITYScheduler::should_preempt_first(std::shared_ptr<Thread> running, std::shared_ptr<Thread> other) {
+    return get_priority(running) > get_priority(other);
+}
+
 int PRIORITYScheduler::get_priority(std::shared_ptr<Thread> thread) {
     switch(thread->priority) {
         case ProcessPriority::SYSTEM:
@@ -65,15 +81,3 @@ int PRIORITYScheduler::get_priority(std::shared_ptr<Thread> thread) {
             throw("Error getting priority");
     }
 }
-
-std::vector<int>* PRIORITYScheduler::get_num_threads() {
-    std::vector<int> *array = new std::vector<int>(4, 0); // Initialize vector with 4 zeros
-    Stable_Priority_Queue<std::shared_ptr<Thread>> queueCopy = priorityQueue;
-
-    while (!queueCopy.empty()) {
-        std::shared_ptr<Thread> thread = queueCopy.top();
-        queueCopy.pop();
-        (*array)[get_priority(thread)]++;
-    }
-    return array;
-}
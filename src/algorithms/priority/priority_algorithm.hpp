@@ -1,13 +1,14 @@
 #ifndef PRIORITY_ALGORITHM_HPP
 #define PRIORITY_ALGORITHM_HPP
 
+#include <array>
 #include <memory>
 #include <string>
 #include <vector>
 #include <queue>
 #include "algorithms/fcfs/fcfs_algorithm.hpp"
 #include "algorithms/scheduling_algorithm.hpp"
-#include "utilities/stable_priority_queue/stable_priority_queue.hpp"
+#include "utilities/bucket_priority_queue/bucket_priority_queue.hpp"
 
 /*
     PRIORITYScheduler:
@@ -20,15 +21,28 @@
 */
 
 // "typedef" this type
-using PriorityQueue = Stable_Priority_Queue<std::shared_ptr<Thread>>; 
+using PriorityQueue = Bucket_Priority_Queue<std::shared_ptr<Thread>, 4>;
 
-class PRIORITYScheduler : public Scheduler {
+class PRIORITYScheduler final : public Scheduler {
 private:
         //==================================================
         //  Member variables
         //==================================================
 
-        // TODO: Add any member variables you may need
+        /*
+            class_counts:
+                How many threads of each priority class are in the ready queue, indexed by
+                get_priority(). Kept up to date as threads are added and taken off, so
+                explaining a decision does not need to look through the queue.
+        */
+        std::array<int, 4> class_counts = {};
+
+        /*
+            preemptive:
+                Whether a thread that becomes ready preempts a running thread of a lower
+                priority class (the PPRIORITY algorithm).
+        */
+        bool preemptive;
 
 public:
 
@@ -36,19 +50,23 @@ public:
         //  Member functions
         //==================================================
 
-        PRIORITYScheduler(int slice = -1);
+        PRIORITYScheduler(int slice = -1, bool preemptive = false);
 
-        std::shared_ptr<SchedulingDecision> get_next_thread();
+        SchedulingDecision get_next_thread();
 
         void add_to_ready_queue(std::shared_ptr<Thread> thread);
 
         size_t size() const;
 
-        Stable_Priority_Queue<std::shared_ptr<Thread>> priorityQueue;
+        std::vector<std::shared_ptr<Thread>> ready_threads() const;
 
-        int get_priority(std::shared_ptr<Thread> thread);
+        bool should_preempt(std::shared_ptr<Thread> running, std::shared_ptr<Thread> arriving);
+
+        bool should_preempt_first(std::shared_ptr<Thread> running, std::shared_ptr<Thread> other);
 
-        std::vector<int>*  get_num_threads();
+        PriorityQueue priorityQueue;
+
+        int get_priority(std::shared_ptr<Thread> thread);
 
 };
 
@@ -0,0 +1,28 @@
+#include "algorithms/rm/rm_algorithm.hpp"
+
+#include <climits>
+
+RMScheduler::RMScheduler(int slice) : EDFScheduler(slice) {}
+
+int RMScheduler::get_key(std::shared_ptr<Thread> thread)
+{
+    if (thread->period != -1)
+    {
+        return thread->period;
+    }
+    if (thread->relative_deadline != -1)
+    {
+        return thread->relative_deadline;
+    }
+    return INT_MAX;
+}
+
+// A thread without a period is ordered by its relative deadline, so say which one was used
+const char* RMScheduler::key_name(std::shared_ptr<Thread> thread) const
+{
+    if (thread->period == -1 && thread->relative_deadline != -1)
+    {
+        return "relative deadline";
+    }
+    return "period";
+}
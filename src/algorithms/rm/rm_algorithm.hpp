@@ -0,0 +1,31 @@
+#ifndef RM_ALGORITHM_HPP
+#define RM_ALGORITHM_HPP
+
+#include <memory>
+#include "algorithms/edf/edf_algorithm.hpp"
+
+/*
+    RMScheduler:
+        A representation of rate-monotonic scheduling.
+
+        Works like EDF, except that threads are ordered by a fixed priority: the thread with
+        the shortest period runs first. Threads without a period use their relative deadline
+        instead, and threads with neither run last.
+*/
+
+class RMScheduler : public EDFScheduler {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    RMScheduler(int slice = -1);
+
+    int get_key(std::shared_ptr<Thread> thread);
+
+    const char* key_name(std::shared_ptr<Thread> thread) const;
+
+};
+
+#endif
@@ -22,27 +22,27 @@ RRScheduler::RRScheduler(int slice)
     }
 }
 
-std::shared_ptr<SchedulingDecision> RRScheduler::get_next_thread()
+SchedulingDecision RRScheduler::get_next_thread()
 {
     if (readyQueue.empty())
     {
         SchedulingDecision emptyDecision;
-        emptyDecision.explanation = "No threads available for scheduling.";
+        emptyDecision.explain("No threads available for scheduling.");
         emptyDecision.thread = nullptr;
         emptyDecision.time_slice = -1;
 
-        return std::make_shared<SchedulingDecision>(emptyDecision);
+        return emptyDecision;
     }
 
     std::shared_ptr<Thread> nextThread = readyQueue.front();
     readyQueue.pop();
 
     SchedulingDecision decision;
-    decision.explanation = "Selected from " + std::to_string(get_num_ready_threads()) + " threads. Will run for at most " + std::to_string(time_slice) + " ticks.";
+    decision.explain("Selected from {} threads. Will run for at most {} ticks.", get_num_ready_threads(), time_slice);
     decision.thread = nextThread;
     decision.time_slice = time_slice;
 
-    return std::make_shared<SchedulingDecision>(decision);
+    return decision;
 }
 
 void RRScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread)
@@ -55,19 +55,20 @@ size_t RRScheduler::size() const
     return readyQueue.size();
 }
 
-// Gets the number of ready threads in the queue
-int RRScheduler::get_num_ready_threads()
+// Lists the queue from front to back
+std::vector<std::shared_ptr<Thread>> RRScheduler::ready_threads() const
 {
-    int readyCount = 0;
-    std::queue<std::shared_ptr<Thread>> tempQueue = readyQueue;
-    while (!tempQueue.empty())
+    std::vector<std::shared_ptr<Thread>> threads;
+    for (auto queue = readyQueue; !queue.empty(); queue.pop())
     {
-        std::shared_ptr<Thread> thread = tempQueue.front();
-        tempQueue.pop();
-        if (thread->current_state == ThreadState::READY)
-        {
-            readyCount++;
-        }
+        threads.push_back(queue.front());
     }
-    return readyCount + 1;
+    return threads;
+}
+
+// Gets the number of ready threads in the queue
+int RRScheduler::get_num_ready_threads()
+{
+    // Every queued thread is READY, plus the one just popped
+    return readyQueue.size() + 1;
 }
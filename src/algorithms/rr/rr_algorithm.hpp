@@ -4,6 +4,7 @@
 #include <memory>
 #include <queue>
 #include <stdexcept>
+#include <vector>
 #include "algorithms/scheduling_algorithm.hpp"
 
 /*
@@ -16,7 +17,7 @@
         feel are helpful for implementing the algorithm.
 */
 
-class RRScheduler : public Scheduler {
+class RRScheduler final : public Scheduler {
 public:
 
     //==================================================
@@ -31,12 +32,14 @@ public:
 
     RRScheduler(int slice = 3);
 
-    std::shared_ptr<SchedulingDecision> get_next_thread();
+    SchedulingDecision get_next_thread();
 
     void add_to_ready_queue(std::shared_ptr<Thread> thread);
 
     size_t size() const;
 
+    std::vector<std::shared_ptr<Thread>> ready_threads() const;
+
     std::queue<std::shared_ptr<Thread>> readyQueue;
 
     int get_num_ready_threads();
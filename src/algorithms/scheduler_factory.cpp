@@ -0,0 +1,111 @@
+#include "algorithms/scheduler_factory.hpp"
+
+#include <stdexcept>
+#include <string>
+
+#include "algorithms/fcfs/fcfs_algorithm.hpp"
+#include "algorithms/spn/spn_algorithm.hpp"
+#include "algorithms/rr/rr_algorithm.hpp"
+#include "algorithms/priority/priority_algorithm.hpp"
+#include "algorithms/mlfq/mlfq_algorithm.hpp"
+#include "algorithms/cfs/cfs_algorithm.hpp"
+#include "algorithms/edf/edf_algorithm.hpp"
+#include "algorithms/rm/rm_algorithm.hpp"
+#include "algorithms/srt/srt_algorithm.hpp"
+#include "algorithms/hrrn/hrrn_algorithm.hpp"
+#include "algorithms/lottery/lottery_algorithm.hpp"
+#include "algorithms/stride/stride_algorithm.hpp"
+// DONE: Include your other algorithms as you make them
+
+std::shared_ptr<Scheduler> make_scheduler(const std::string& algorithm, int time_slice, int mlfq_levels, const std::vector<int>& mlfq_quanta)
+{
+    // DONE: Add your other algorithms as you make them
+    if (algorithm == "FCFS")
+    {
+        return std::make_shared<FCFSScheduler>();
+    }
+    else if (algorithm == "SPN")
+    {
+        return std::make_shared<SPNScheduler>();
+    }
+    else if (algorithm == "SRT")
+    {
+        return std::make_shared<SRTScheduler>();
+    }
+    else if (algorithm == "SRT-ORACLE")
+    {
+        return std::make_shared<SRTScheduler>(-1, true);
+    }
+    else if (algorithm == "HRRN")
+    {
+        return std::make_shared<HRRNScheduler>();
+    }
+    else if (algorithm == "HRRN-ORACLE")
+    {
+        return std::make_shared<HRRNScheduler>(-1, true);
+    }
+    else if (algorithm == "RR")
+    {
+        return std::make_shared<RRScheduler>(time_slice);
+    }
+    else if (algorithm == "PRIORITY")
+    {
+        return std::make_shared<PRIORITYScheduler>();
+    }
+    else if (algorithm == "PPRIORITY")
+    {
+        return std::make_shared<PRIORITYScheduler>(-1, true);
+    }
+    else if (algorithm == "LOTTERY")
+    {
+        return std::make_shared<LotteryScheduler>(time_slice);
+    }
+    else if (algorithm == "STRIDE")
+    {
+        return std::make_shared<StrideScheduler>(time_slice);
+    }
+    else if (algorithm == "MLFQ")
+    {
+        if (mlfq_quanta.empty())
+        {
+            if (mlfq_levels == 0)
+            {
+                return std::make_shared<MLFQScheduler>();
+            }
+            return std::make_shared<MLFQScheduler>(-1, mlfq_levels);
+        }
+        if (mlfq_levels != 0 && mlfq_levels != (int) mlfq_quanta.size())
+        {
+            throw std::invalid_argument("MLFQ was given " + std::to_string(mlfq_levels) + " levels but " +
+                                        std::to_string(mlfq_quanta.size()) + " quanta.");
+        }
+        return std::make_shared<MLFQScheduler>(mlfq_quanta);
+    }
+    else if (algorithm == "CFS")
+    {
+        return std::make_shared<CFSScheduler>(time_slice);
+    }
+    else if (algorithm == "EDF")
+    {
+        return std::make_shared<EDFScheduler>();
+    }
+    else if (algorithm == "RM")
+    {
+        return std::make_shared<RMScheduler>();
+    }
+    else
+    {
+        throw std::runtime_error("No scheduler found for " + algorithm);
+    }
+}
+
+bool takes_time_slice(const std::string& algorithm)
+{
+    return algorithm == "RR" || algorithm == "LOTTERY" || algorithm == "STRIDE" || algorithm == "CFS";
+}
+
+const std::vector<std::string>& available_algorithms()
+{
+    static const std::vector<std::string> algorithms = {"FCFS", "SPN", "SRT", "SRT-ORACLE", "HRRN", "HRRN-ORACLE", "RR", "PRIORITY", "PPRIORITY", "LOTTERY", "STRIDE", "MLFQ", "CFS", "EDF", "RM"};
+    return algorithms;
+}
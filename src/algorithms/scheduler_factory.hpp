@@ -0,0 +1,34 @@
+#ifndef SCHEDULER_FACTORY_HPP
+#define SCHEDULER_FACTORY_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "algorithms/scheduling_algorithm.hpp"
+
+/*
+    make_scheduler(algorithm, time_slice, mlfq_levels, mlfq_quanta):
+        Creates a new scheduler for the named algorithm (one of the names accepted by the
+        -a, --algorithm flag), passing the time slice on to the algorithms that take one.
+        Throws a std::runtime_error if there is no such algorithm.
+
+        MLFQ gets mlfq_levels levels with the default quanta, or 0 for the default number
+        of levels, unless mlfq_quanta gives the quantum of each level. If both are given,
+        they must agree on the number of levels.
+*/
+std::shared_ptr<Scheduler> make_scheduler(const std::string& algorithm, int time_slice, int mlfq_levels = 0, const std::vector<int>& mlfq_quanta = {});
+
+/*
+    available_algorithms():
+        Returns the names of every algorithm make_scheduler can create.
+*/
+const std::vector<std::string>& available_algorithms();
+
+/*
+    takes_time_slice(algorithm):
+        Returns true if the named algorithm accepts a time slice from the -s, --time_slice flag.
+*/
+bool takes_time_slice(const std::string& algorithm);
+
+#endif
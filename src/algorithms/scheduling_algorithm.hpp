@@ -2,9 +2,12 @@
 #define SCHEDULING_ALGORITHM_HPP
 
 #include <memory>
+#include <stdexcept>
+#include <vector>
 #include "types/enums.hpp"
 #include "types/event/event.hpp"
 #include "types/scheduling_decision/scheduling_decision.hpp"
+#include "types/system_stats/system_stats.hpp"
 #include "types/thread/thread.hpp"
 
 /*
@@ -31,6 +34,13 @@ public:
     */
     int time_slice = -1;
 
+    /*
+        current_time:
+            The simulation clock. The simulation updates it before handling each event, for
+            algorithms whose decisions depend on how long threads have been waiting.
+    */
+    unsigned int current_time = 0;
+
     //==================================================
     //  Member functions
     //==================================================
@@ -47,8 +57,34 @@ public:
                     This might be, for the first come, first served algorithm, something like this:
                         "Selected from 9 threads. Will run to completion of burst."
                     This message is used when printing the state transitions (see the Logger class).
+                    It is set with SchedulingDecision::explain(), so that it is only formatted
+                    when it is printed:
+                        decision.explain("Selected from {} threads. Will run to completion of burst.", count);
+    */
+    virtual SchedulingDecision get_next_thread() = 0;
+
+    /*
+        get_next_thread_for(cpu):
+            Like get_next_thread(), but for the dispatcher of a particular CPU when simulating
+            more than one. Algorithms that keep per-CPU state can override this; by default
+            every CPU shares the same ready queue(s).
+    */
+    virtual SchedulingDecision get_next_thread_for(int cpu) { return get_next_thread(); }
+
+    /*
+        select_cpu(thread, idle_cpus):
+            Chooses which of the idle CPUs (given in increasing order, never empty) should
+            run its dispatcher for a thread that just became ready. By default the thread goes
+            back to the CPU it last ran on if that CPU is idle, and to the lowest idle CPU otherwise.
     */
-    virtual std::shared_ptr<SchedulingDecision> get_next_thread() = 0;
+    virtual int select_cpu(std::shared_ptr<Thread> thread, const std::vector<int>& idle_cpus) {
+        for (int cpu : idle_cpus) {
+            if (cpu == thread->last_cpu) {
+                return cpu;
+            }
+        }
+        return idle_cpus.front();
+    }
 
     /*
         add_to_ready_queue(Thread):
@@ -59,6 +95,81 @@ public:
     */
     virtual void add_to_ready_queue(std::shared_ptr<Thread> thread) = 0;
 
+    /*
+        should_preempt(running, arriving):
+            Called when a thread becomes ready (it arrives or finishes its IO) while no CPU is
+            idle, once for each CPU that is running a thread. Returning true takes the running
+            thread off its CPU right away, as if its time slice had run out, so the dispatcher
+            can choose between it and the ready threads. The arriving thread is already in the
+            ready queue. By default threads are never preempted this way.
+    */
+    virtual bool should_preempt(std::shared_ptr<Thread> running, std::shared_ptr<Thread> arriving) { return false; }
+
+    /*
+        should_preempt_first(running, other):
+            Called when should_preempt() is true for more than one CPU, to choose which of them
+            gives up its thread. Returns true if the running thread is worse to keep running
+            than the other one, such as one with a later deadline. By default the first such
+            CPU is preempted.
+    */
+    virtual bool should_preempt_first(std::shared_ptr<Thread> running, std::shared_ptr<Thread> other) { return false; }
+
+    /*
+        dispatch_when_empty():
+            Returns true if get_next_thread_for() has to be called even while the ready queue(s)
+            are empty, for algorithms that do other work when a dispatcher runs. Otherwise,
+            when dispatches are coalesced, the simulation leaves a CPU idle without asking.
+            Returns false by default.
+    */
+    virtual bool dispatch_when_empty() const { return false; }
+
+    /*
+        take_woken_cpus(cpus):
+            Appends the CPUs whose run queues were given threads during the last call to
+            get_next_thread_for() other than the CPU it was called for, such as by periodic
+            rebalancing, and forgets them. The simulation invokes the dispatcher of each of
+            them that is idle, since nothing else would. Appends nothing by default.
+    */
+    virtual void take_woken_cpus(std::vector<int>& cpus) {}
+
+    /*
+        steal_thread():
+            Removes a thread from the ready queue(s) so that it can be moved to another
+            scheduler, or returns nullptr if there are none. By default this takes the thread
+            that get_next_thread() would have chosen.
+    */
+    virtual std::shared_ptr<Thread> steal_thread() { return get_next_thread().thread; }
+
+    /*
+        ready_threads():
+            Returns the threads in the ready queue(s), in the order they would be chosen if no
+            others became ready, without changing anything. Used to save checkpoints. Algorithms
+            that do not support checkpoints (the default) throw instead.
+    */
+    virtual std::vector<std::shared_ptr<Thread>> ready_threads() const {
+        throw std::runtime_error("This scheduling algorithm does not support checkpoints.");
+    }
+
+    /*
+        restore_ready_threads(threads):
+            Puts back the threads that ready_threads() returned when a checkpoint is restored,
+            so that they will be chosen in the same order. The threads are already as they were
+            after being added, so they must not be changed again. By default each one is added
+            with add_to_ready_queue().
+    */
+    virtual void restore_ready_threads(const std::vector<std::shared_ptr<Thread>>& threads) {
+        for (const auto& thread : threads) {
+            add_to_ready_queue(thread);
+        }
+    }
+
+    /*
+        report_stats(stats):
+            Adds any statistics specific to the algorithm to the simulation's statistics
+            at the end of the simulation. Does nothing by default.
+    */
+    virtual void report_stats(SystemStats& stats) const {}
+
     /*
         size():
             Returns the number of threads in the scheduler's ready queue(s).
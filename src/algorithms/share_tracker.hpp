@@ -0,0 +1,65 @@
+#ifndef SHARE_TRACKER_HPP
+#define SHARE_TRACKER_HPP
+
+#include <cstdint>
+
+#include "types/system_stats/system_stats.hpp"
+#include "types/thread/thread.hpp"
+
+/*
+    ShareTracker:
+        Keeps the statistics a proportional-share scheduler reports: how the dispatches it
+        made while threads were competing went by process priority, next to how they should
+        have gone given the tickets of the ready threads. Over a whole run every thread gets
+        all the CPU time it needs, so the split of the total service time says nothing about
+        the scheduler; the split of contended dispatches does.
+
+        The scheduler calls add() and remove() as threads enter and leave its ready queue, and
+        dispatched() for the chosen thread before removing it.
+*/
+
+class ShareTracker {
+public:
+    void add(const Thread& thread) {
+        ready_tickets[thread.priority] += thread.ticket_count();
+        total_tickets += thread.ticket_count();
+        num_ready++;
+    }
+
+    void remove(const Thread& thread) {
+        ready_tickets[thread.priority] -= thread.ticket_count();
+        total_tickets -= thread.ticket_count();
+        num_ready--;
+    }
+
+    void dispatched(const Thread& thread) {
+        if (num_ready < 2) {
+            return;
+        }
+        contended_dispatches++;
+        class_wins[thread.priority]++;
+        for (int priority = SYSTEM; priority <= BATCH; ++priority) {
+            class_entitlements[priority] += double(ready_tickets[priority]) / total_tickets;
+        }
+    }
+
+    // Adds to the stats rather than setting them, since every per-CPU run queue reports
+    void report(SystemStats& stats) const {
+        stats.contended_dispatches += contended_dispatches;
+        for (int priority = SYSTEM; priority <= BATCH; ++priority) {
+            stats.class_wins[priority] += class_wins[priority];
+            stats.class_entitlements[priority] += class_entitlements[priority];
+        }
+    }
+
+private:
+    int64_t ready_tickets[4] = {0, 0, 0, 0};
+    int64_t total_tickets = 0;
+    int num_ready = 0;
+
+    size_t contended_dispatches = 0;
+    size_t class_wins[4] = {0, 0, 0, 0};
+    double class_entitlements[4] = {0.0, 0.0, 0.0, 0.0};
+};
+
+#endif
@@ -17,31 +17,31 @@ SPNScheduler::SPNScheduler(int slice)
 }
 
 // Gets the next thread based on SPN
-std::shared_ptr<SchedulingDecision> SPNScheduler::get_next_thread()
+SchedulingDecision SPNScheduler::get_next_thread()
 {
     if (priorityQueue.empty())
     {
         SchedulingDecision emptyDecision;
-        emptyDecision.explanation = "No threads available for scheduling.";
+        emptyDecision.explain("No threads available for scheduling.");
         emptyDecision.thread = nullptr;
         emptyDecision.time_slice = -1;
 
-        return std::make_shared<SchedulingDecision>(emptyDecision);
+        return emptyDecision;
     }
     std::shared_ptr<Thread> nextThread = priorityQueue.top();
     priorityQueue.pop();
     SchedulingDecision decision;
-    decision.explanation = "Selected from " + std::to_string(get_num_ready_threads()) + " threads. Will run to completion of burst.";
+    decision.explain("Selected from {} threads. Will run to completion of burst.", get_num_ready_threads());
     decision.thread = nextThread;
     decision.time_slice = -1;
 
-    return std::make_shared<SchedulingDecision>(decision);
+    return decision;
 }
 
 // Adds a thread to the ready queue
 void SPNScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread)
 {
-    priorityQueue.push(get_next_cpu_burst_length(thread), thread);
+    priorityQueue.push(thread->peek_next_burst(CPU), thread);
 }
 
 // Gets the size of the queue
@@ -50,41 +50,21 @@ size_t SPNScheduler::size() const
     return priorityQueue.size();
 }
 
-// Gets the number of ready threads in the queue
-int SPNScheduler::get_num_ready_threads()
+// Lists the queue in the order it would be popped. Adding them back in this order gives equal
+// bursts the same order, since the queue breaks ties by when threads were added.
+std::vector<std::shared_ptr<Thread>> SPNScheduler::ready_threads() const
 {
-    int readyCount = 0;
-    Stable_Priority_Queue<std::shared_ptr<Thread>> tempQueue = priorityQueue;
-    while (!tempQueue.empty())
+    std::vector<std::shared_ptr<Thread>> threads;
+    for (auto queue = priorityQueue; !queue.empty(); queue.pop())
     {
-        std::shared_ptr<Thread> thread = tempQueue.top();
-        tempQueue.pop();
-
-        if (thread->current_state == ThreadState::READY)
-        {
-            readyCount++;
-        }
+        threads.push_back(queue.top());
     }
-    return readyCount + 1;
+    return threads;
 }
 
-int SPNScheduler::get_next_cpu_burst_length(std::shared_ptr<Thread> thread)
+// Gets the number of ready threads in the queue
+int SPNScheduler::get_num_ready_threads()
 {
-    std::queue<std::shared_ptr<Burst>> burstsCopy = thread->bursts;
-    if (burstsCopy.empty())
-    {
-        return 0;
-    }
-    std::shared_ptr<Burst> currentBurst = burstsCopy.front();
-    burstsCopy.pop();
-    while (currentBurst->burst_type != BurstType::CPU)
-    {
-        if (burstsCopy.empty())
-        {
-            return 0;
-        }
-        currentBurst = burstsCopy.front();
-        burstsCopy.pop();
-    }
-    return currentBurst->length;
+    // Every queued thread is READY. The queue keeps its own size, so nothing is copied.
+    return priorityQueue.size() + 1;
 }
@@ -2,6 +2,7 @@
 #define SPN_ALGORITHM_HPP
 
 #include <memory>
+#include <vector>
 #include "algorithms/scheduling_algorithm.hpp"
 #include "utilities/stable_priority_queue/stable_priority_queue.hpp"
 
@@ -15,7 +16,7 @@
         feel are helpful for implementing the algorithm.
 */
 
-class SPNScheduler : public Scheduler {
+class SPNScheduler final : public Scheduler {
 public:
 
     //==================================================
@@ -30,18 +31,18 @@ public:
 
     SPNScheduler(int slice = -1);
 
-    std::shared_ptr<SchedulingDecision> get_next_thread();
+    SchedulingDecision get_next_thread();
 
     void add_to_ready_queue(std::shared_ptr<Thread> thread);
 
     size_t size() const;
 
+    std::vector<std::shared_ptr<Thread>> ready_threads() const;
+
     Stable_Priority_Queue<std::shared_ptr<Thread>> priorityQueue;
     
     int get_num_ready_threads();
 
-    int get_next_cpu_burst_length(std::shared_ptr<Thread> thread);
-
 };
 
 #endif
@@ -0,0 +1,82 @@
+#include <cstdint>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "algorithms/spn/spn_algorithm.hpp"
+#include "utilities/benchmark/benchmark.hpp"
+
+/*
+    Measures how SPN's next-CPU-burst lookup scales with the number of bursts per thread.
+    Every thread is blocked halfway through its bursts, so the lookup has to look past an
+    IO burst, which is the case add_to_ready_queue hits after every IO completion.
+
+    For reference, it also times what the lookup used to do: copy the thread's whole queue
+    of shared Burst pointers and pop until it reached a CPU burst.
+*/
+
+namespace {
+
+const int NUM_THREADS = 1000;
+
+std::vector<std::shared_ptr<Thread>> make_threads(const std::shared_ptr<const std::vector<int32_t>>& table) {
+    std::vector<std::shared_ptr<Thread>> threads;
+    for (int thread_id = 0; thread_id < NUM_THREADS; ++thread_id) {
+        auto thread = std::make_shared<Thread>(0, thread_id, 0, NORMAL);
+        thread->set_bursts(std::shared_ptr<const int32_t>(table, table->data()), table->size());
+        while (thread->next_burst < table->size() / 2 || thread->next_burst_type() != IO) {
+            thread->pop_next_burst(thread->next_burst_type());
+        }
+        threads.push_back(thread);
+    }
+    return threads;
+}
+
+}
+
+BENCHMARK(spn_next_cpu_burst) {
+    for (uint32_t num_bursts : {15u, 255u, 4095u}) {
+        auto table = std::make_shared<std::vector<int32_t>>();
+        for (uint32_t n = 0; n < num_bursts; ++n) {
+            table->push_back(1 + (n * 7919) % 500);
+        }
+
+        auto threads = make_threads(table);
+
+        // Every thread goes through the ready queue once per repetition
+        double spn_seconds = time_best_of(5, [&] {
+            SPNScheduler scheduler;
+            for (const auto& thread : threads) {
+                scheduler.add_to_ready_queue(thread);
+            }
+            while (!scheduler.priorityQueue.empty()) {
+                scheduler.priorityQueue.pop();
+            }
+        });
+
+        std::queue<std::shared_ptr<int32_t>> burst_queue;
+        for (uint32_t n = num_bursts / 2; n < num_bursts; ++n) {
+            burst_queue.push(std::make_shared<int32_t>((*table)[n]));
+        }
+
+        int64_t total = 0;
+        double copy_seconds = time_best_of(5, [&] {
+            for (int thread = 0; thread < NUM_THREADS; ++thread) {
+                std::queue<std::shared_ptr<int32_t>> copy = burst_queue;
+                copy.pop();
+                total += *copy.front();
+            }
+        });
+
+        // Using the result keeps the copies from being optimized away
+        if (total <= 0) {
+            throw std::logic_error("The copied queues had no CPU bursts.");
+        }
+
+        std::string label = std::to_string(num_bursts) + " bursts";
+        report(label + ", SPN add_to_ready_queue", spn_seconds, NUM_THREADS, "threads");
+        report(label + ", copying the burst queue", copy_seconds, NUM_THREADS, "threads");
+    }
+}
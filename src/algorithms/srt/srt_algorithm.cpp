@@ -0,0 +1,70 @@
+#include "algorithms/srt/srt_algorithm.hpp"
+
+#include <cassert>
+#include <stdexcept>
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+SRTScheduler::SRTScheduler(int slice, bool oracle) : oracle(oracle)
+{
+    if (slice != -1)
+    {
+        throw("SRT does NOT take a customizable time slice");
+    }
+}
+
+SchedulingDecision SRTScheduler::get_next_thread()
+{
+    if (priorityQueue.empty())
+    {
+        SchedulingDecision emptyDecision;
+        emptyDecision.explain("No threads available for scheduling.");
+        emptyDecision.thread = nullptr;
+        emptyDecision.time_slice = -1;
+
+        return emptyDecision;
+    }
+
+    int num_ready = priorityQueue.size();
+    std::shared_ptr<Thread> nextThread = priorityQueue.top();
+    priorityQueue.pop();
+
+    SchedulingDecision decision;
+    decision.thread = nextThread;
+    decision.time_slice = -1;
+    decision.explain("Selected from {} threads ({} = {}). Will run to completion of burst.",
+                     num_ready, oracle ? "remaining time" : "estimated remaining time",
+                     expected_remaining_time(nextThread));
+
+    return decision;
+}
+
+void SRTScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread)
+{
+    priorityQueue.push(expected_remaining_time(thread), thread);
+}
+
+size_t SRTScheduler::size() const
+{
+    return priorityQueue.size();
+}
+
+// A thread preempts the running thread if it is expected to finish before the running thread
+bool SRTScheduler::should_preempt(std::shared_ptr<Thread> running, std::shared_ptr<Thread> arriving)
+{
+    int ran = current_time - running->state_change_time;
+    return expected_remaining_time(arriving) < expected_remaining_time(running) - ran;
+}
+
+bool SRTScheduler::should_preempt_first(std::shared_ptr<Thread> running, std::shared_ptr<Thread> other)
+{
+    int running_left = expected_remaining_time(running) - (current_time - running->state_change_time);
+    int other_left = expected_remaining_time(other) - (current_time - other->state_change_time);
+    return running_left > other_left;
+}
+
+int SRTScheduler::expected_remaining_time(std::shared_ptr<Thread> thread) const
+{
+    return oracle ? thread->peek_next_burst(CPU) : thread->estimated_remaining_time();
+}
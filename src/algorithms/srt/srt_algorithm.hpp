@@ -0,0 +1,62 @@
+#ifndef SRT_ALGORITHM_HPP
+#define SRT_ALGORITHM_HPP
+
+#include <memory>
+#include "algorithms/scheduling_algorithm.hpp"
+#include "utilities/stable_priority_queue/stable_priority_queue.hpp"
+
+/*
+    SRTScheduler:
+        A representation of shortest-remaining-time scheduling, the preemptive version of SPN.
+
+        The ready thread expected to finish its CPU burst soonest runs next, to the completion
+        of its burst unless a thread that is expected to finish sooner than what is left of it
+        becomes ready and preempts it. Threads with the same expected time run in the order
+        they became ready.
+
+        By default the expected time comes from the thread's burst_estimate, so the scheduler
+        only knows as much as a real one would. The oracle variant reads the actual remaining
+        time from the simulation file instead, to show what the estimates cost.
+*/
+
+class SRTScheduler : public Scheduler {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        oracle:
+            Whether the scheduler uses the actual burst lengths instead of the estimates.
+    */
+    bool oracle = false;
+
+    Stable_Priority_Queue<std::shared_ptr<Thread>> priorityQueue;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    SRTScheduler(int slice = -1, bool oracle = false);
+
+    SchedulingDecision get_next_thread();
+
+    void add_to_ready_queue(std::shared_ptr<Thread> thread);
+
+    size_t size() const;
+
+    bool should_preempt(std::shared_ptr<Thread> running, std::shared_ptr<Thread> arriving);
+
+    bool should_preempt_first(std::shared_ptr<Thread> running, std::shared_ptr<Thread> other);
+
+    /*
+        expected_remaining_time(thread):
+            How much of its next CPU burst the thread is expected to have left, not counting
+            time it has spent running since it was last dispatched.
+    */
+    int expected_remaining_time(std::shared_ptr<Thread> thread) const;
+
+};
+
+#endif
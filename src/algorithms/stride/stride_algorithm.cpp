@@ -0,0 +1,93 @@
+#include "algorithms/stride/stride_algorithm.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+StrideScheduler::StrideScheduler(int slice)
+{
+    if (slice == -1)
+    {
+        time_slice = 3;
+    }
+    else
+    {
+        time_slice = slice;
+    }
+}
+
+SchedulingDecision StrideScheduler::get_next_thread()
+{
+    if (passes.empty())
+    {
+        SchedulingDecision emptyDecision;
+        emptyDecision.explain("No threads available for scheduling.");
+        emptyDecision.thread = nullptr;
+        emptyDecision.time_slice = -1;
+
+        return emptyDecision;
+    }
+
+    int num_ready = passes.size();
+    Entry entry = passes.top();
+    passes.pop();
+
+    global_pass = entry.pass;
+    shares.dispatched(*entry.thread);
+    shares.remove(*entry.thread);
+    entry.thread->prev_service_time = entry.thread->service_time;
+
+    SchedulingDecision decision;
+    decision.thread = entry.thread;
+    decision.time_slice = time_slice;
+    decision.explain("Selected from {} threads (pass = {}). Will run for at most {} ticks.",
+                     num_ready, entry.pass, time_slice);
+
+    return decision;
+}
+
+void StrideScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread)
+{
+    // Charge the thread for however long it ran since it was dispatched
+    thread->stride_pass += (thread->service_time - thread->prev_service_time) * get_stride(thread);
+    thread->prev_service_time = thread->service_time;
+
+    if (thread->previous_state != RUNNING)
+    {
+        thread->stride_pass = std::max(thread->stride_pass, global_pass);
+    }
+
+    passes.push({thread->stride_pass, next_sequence++, thread});
+    shares.add(*thread);
+}
+
+std::shared_ptr<Thread> StrideScheduler::steal_thread()
+{
+    if (passes.empty())
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<Thread> thread = passes.top().thread;
+    passes.pop();
+    shares.remove(*thread);
+    return thread;
+}
+
+size_t StrideScheduler::size() const
+{
+    return passes.size();
+}
+
+void StrideScheduler::report_stats(SystemStats& stats) const
+{
+    shares.report(stats);
+}
+
+int64_t StrideScheduler::get_stride(std::shared_ptr<Thread> thread)
+{
+    return std::max<int64_t>(STRIDE1 / thread->ticket_count(), 1);
+}
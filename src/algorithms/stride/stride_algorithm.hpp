@@ -0,0 +1,81 @@
+#ifndef STRIDE_ALGORITHM_HPP
+#define STRIDE_ALGORITHM_HPP
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <vector>
+#include "algorithms/scheduling_algorithm.hpp"
+#include "algorithms/share_tracker.hpp"
+
+/*
+    StrideScheduler:
+        A representation of stride scheduling, the deterministic counterpart of lottery
+        scheduling.
+
+        Every thread has a stride, STRIDE1 divided by its ticket_count() (but at least 1), and a pass value that
+        grows by its stride for every tick it runs. The ready thread with the lowest pass runs
+        next, for at most one time slice, so threads get CPU time in proportion to their
+        tickets without any randomness. Threads with the same pass run in the order they
+        became ready.
+
+        A thread that arrives or comes back from IO starts from the pass of the thread
+        dispatched last, if that is higher than its own, so it cannot save up CPU time while
+        it is away.
+
+        Ready threads are kept in a binary heap of pass values.
+*/
+
+class StrideScheduler : public Scheduler {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    // Large enough that ticket counts up to 2^30 get distinct strides, and small enough that a
+    // one-ticket thread's pass cannot overflow in 2^32 ticks
+    static const int64_t STRIDE1 = int64_t(1) << 30;
+
+    struct Entry {
+        int64_t pass;
+        uint64_t sequence;
+        std::shared_ptr<Thread> thread;
+
+        bool operator>(const Entry& other) const {
+            return pass > other.pass || (pass == other.pass && sequence > other.sequence);
+        }
+    };
+
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> passes;
+
+    uint64_t next_sequence = 0;
+
+    // The pass of the thread that was dispatched last
+    int64_t global_pass = 0;
+
+    ShareTracker shares;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    StrideScheduler(int slice = -1);
+
+    SchedulingDecision get_next_thread();
+
+    void add_to_ready_queue(std::shared_ptr<Thread> thread);
+
+    size_t size() const;
+
+    // Takes the thread with the lowest pass without moving global_pass or counting a dispatch
+    std::shared_ptr<Thread> steal_thread();
+
+    void report_stats(SystemStats& stats) const;
+
+    int64_t get_stride(std::shared_ptr<Thread> thread);
+
+};
+
+#endif
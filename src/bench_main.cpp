@@ -0,0 +1,31 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "utilities/benchmark/benchmark.hpp"
+
+int main(int argc, char **argv)
+{
+    std::vector<std::string> names(argv + 1, argv + argc);
+
+    for (const auto& entry : benchmarks())
+    {
+        bool selected = names.empty();
+        for (const auto& name : names)
+        {
+            if (entry.first.compare(0, name.size(), name) == 0)
+            {
+                selected = true;
+            }
+        }
+
+        if (selected)
+        {
+            std::cout << entry.first << ":\n";
+            entry.second();
+            std::cout << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -3,9 +3,21 @@
 
 #include "utilities/flags/flags.hpp"
 #include "simulation/simulation.hpp"
+#include "sweep/sweep.hpp"
+#include "utilities/binary_trace/binary_trace.hpp"
 
 int main(int argc, char **argv)
 {
+    if (argc > 1 && std::string(argv[1]) == "sweep")
+    {
+        return run_sweep(argc - 1, argv + 1);
+    }
+
+    if (argc > 1 && std::string(argv[1]) == "convert")
+    {
+        return run_convert(argc - 1, argv + 1);
+    }
+
     int error = 0;
     FlagOptions flags;
 
@@ -25,4 +37,8 @@ try {
     catch (std::string const& e) {
         std::cerr << e << std::endl;
     }
+    catch (std::exception const& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
 }
@@ -1,136 +1,624 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
 
+#include "algorithms/scheduler_factory.hpp"
 #include "algorithms/fcfs/fcfs_algorithm.hpp"
-#include "algorithms/spn/spn_algorithm.hpp"
-#include "algorithms/rr/rr_algorithm.hpp"
-#include "algorithms/priority/priority_algorithm.hpp"
 #include "algorithms/mlfq/mlfq_algorithm.hpp"
-// DONE: Include your other algorithms as you make them
+#include "algorithms/per_cpu/per_cpu_algorithm.hpp"
+#include "algorithms/priority/priority_algorithm.hpp"
+#include "algorithms/rr/rr_algorithm.hpp"
+#include "algorithms/spn/spn_algorithm.hpp"
 
 #include "simulation/simulation.hpp"
 #include "types/enums.hpp"
 
 #include "utilities/flags/flags.hpp"
+#include "utilities/binary_trace/binary_trace.hpp"
+#include "utilities/checkpoint/checkpoint.hpp"
+#include "utilities/mapped_file/mapped_file.hpp"
+#include "utilities/trace_parser/trace_parser.hpp"
 
 Simulation::Simulation(FlagOptions flags)
 {
-    // DONE: Add your other algorithms as you make them
-    if (flags.scheduler == "FCFS")
+    if (flags.per_cpu_queues)
     {
-        this->scheduler = std::make_shared<FCFSScheduler>();
+        bool idle_steal = flags.balance == "steal" || flags.balance == "both";
+        int rebalance_interval = (flags.balance == "periodic" || flags.balance == "both") ? flags.balance_interval : 0;
+        this->scheduler = std::make_shared<PerCPUScheduler>(flags.scheduler, flags.time_slice, flags.num_cpus, idle_steal, rebalance_interval,
+                                                            flags.mlfq_levels, flags.mlfq_quanta);
     }
-    else if (flags.scheduler == "SPN")
+    else
     {
-        this->scheduler = std::make_shared<SPNScheduler>();
+        this->scheduler = make_scheduler(flags.scheduler, flags.time_slice, flags.mlfq_levels, flags.mlfq_quanta);
     }
-    else if (flags.scheduler == "RR")
+
+    for (int cpu = 0; cpu < flags.num_cpus; cpu++)
     {
-        this->scheduler = std::make_shared<RRScheduler>(flags.time_slice);
+        this->cores.emplace_back(cpu);
     }
-    else if (flags.scheduler == "PRIORITY")
+    this->idle_cpus.reserve(flags.num_cpus);
+    this->system_stats.cpu_service_times.resize(flags.num_cpus, 0);
+    this->system_stats.cpu_dispatch_times.resize(flags.num_cpus, 0);
+    this->system_stats.cpu_idle_times.resize(flags.num_cpus, 0);
+    this->events = EventQueue(flags.event_queue == "wheel" ? WHEEL_QUEUE : HEAP_QUEUE);
+    this->flags = flags;
+    this->logger = Logger(flags.verbose, flags.per_thread, flags.metrics, flags.num_cpus);
+}
+
+void Simulation::run()
+{
+    if (this->flags.checkpoint_every > 0 || this->flags.restore != "")
+    {
+        if (this->flags.stream)
+        {
+            throw std::runtime_error("Checkpoints cannot be used while streaming.");
+        }
+
+        // Throws for the schedulers that cannot be checkpointed, before anything is simulated
+        this->scheduler->ready_threads();
+    }
+
+    if (this->flags.stream)
     {
-        this->scheduler = std::make_shared<PRIORITYScheduler>();
+        this->open_stream(this->flags.filename);
     }
-    else if (flags.scheduler == "MLFQ")
+    else if (this->flags.restore != "")
     {
-        this->scheduler = std::make_shared<MLFQScheduler>();
+        this->restore_checkpoint(read_file(this->flags.filename), this->flags.restore);
     }
     else
     {
-        throw std::runtime_error("No scheduler found for " + flags.scheduler);
+        this->load_workload(read_file(this->flags.filename));
+    }
+    this->simulate();
+
+    // We are done!
+
+    std::cout << "SIMULATION COMPLETED!\n\n";
+
+    for (auto entry : this->processes)
+    {
+        this->logger.print_per_thread_metrics(entry.second);
+    }
+
+    SystemStats stats = this->calculate_statistics();
+    logger.print_simulation_metrics(stats);
+    if (this->flags.idle_histogram)
+    {
+        logger.print_idle_histogram(stats);
     }
-    this->flags = flags;
-    this->logger = Logger(flags.verbose, flags.per_thread, flags.metrics);
 }
 
-void Simulation::run()
+void Simulation::load_workload(Workload workload)
 {
-    this->read_file(this->flags.filename);
-    while (!this->events.empty())
+    this->thread_switch_overhead = workload.thread_switch_overhead;
+    this->process_switch_overhead = workload.process_switch_overhead;
+
+    for (const auto &process : workload.processes)
     {
-        auto event = this->events.top();
-        this->events.pop();
+        this->processes[process->process_id] = process;
 
-        // Invoke the appropriate method in the simulation for the given event type.
+        for (const auto &thread : process->threads)
+        {
+            this->add_event(Event(EventType::THREAD_ARRIVED, thread->arrival_time, this->event_num, thread));
+            this->event_num++;
+        }
+    }
+}
+
+void Simulation::open_stream(const std::string& filename)
+{
+    auto file = std::make_shared<const MappedFile>(filename);
+    if (!BinaryTrace::matches(file->data(), file->size()))
+    {
+        throw std::runtime_error(filename + ": streaming needs a binary simulation file (see cpu-sim convert)");
+    }
+    this->stream_trace = std::make_shared<BinaryTrace>(file, filename);
+
+    const BinaryTraceHeader &header = this->stream_trace->header();
+    this->thread_switch_overhead = header.thread_switch_overhead;
+    this->process_switch_overhead = header.process_switch_overhead;
 
-        switch (event->type)
+    for (uint32_t index = 0; index < header.num_processes; index++)
+    {
+        const BinaryTraceProcess &entry = this->stream_trace->process(index);
+        auto process = std::make_shared<Process>(entry.process_id, (ProcessPriority)entry.priority);
+        process->tickets = entry.tickets;
+        if (this->flags.per_thread)
         {
-        case THREAD_ARRIVED:
-            this->handle_thread_arrived(event);
-            break;
+            process->threads.resize(entry.num_threads);
+        }
+        this->processes[process->process_id] = process;
+        this->stream_processes.push_back(process);
+    }
 
-        case THREAD_DISPATCH_COMPLETED:
-        case PROCESS_DISPATCH_COMPLETED:
-            this->handle_dispatch_completed(event);
-            break;
+    // Arrivals take the event_nums below num_threads
+    this->event_num = header.num_threads;
+}
 
-        case CPU_BURST_COMPLETED:
-            this->handle_cpu_burst_completed(event);
-            break;
+void Simulation::stream_arrivals()
+{
+    if (!this->stream_trace)
+    {
+        return;
+    }
 
-        case IO_BURST_COMPLETED:
-            this->handle_io_burst_completed(event);
-            break;
-        case THREAD_COMPLETED:
-            this->handle_thread_completed(event);
-            break;
+    while (this->next_arrival < this->stream_trace->header().num_threads)
+    {
+        uint32_t index = this->stream_trace->arrival(this->next_arrival);
+        const BinaryTraceThread &entry = this->stream_trace->thread(index);
+        if (!this->events.empty() && (unsigned int)entry.arrival_time > this->events.next_time())
+        {
+            return;
+        }
 
-        case THREAD_PREEMPTED:
-            this->handle_thread_preempted(event);
-            break;
+        size_t process = this->stream_trace->process_index(index);
+        uint32_t thread_id = index - this->stream_trace->process(process).first_thread;
+        std::shared_ptr<Thread> thread = this->stream_trace->make_thread(process, thread_id);
+        if (this->flags.per_thread)
+        {
+            this->stream_processes[process]->threads[thread_id] = thread;
+        }
 
-        case DISPATCHER_INVOKED:
-            this->handle_dispatcher_invoked(event);
-            break;
+        this->add_event(Event(EventType::THREAD_ARRIVED, thread->arrival_time, index, thread));
+        this->next_arrival++;
+    }
+}
+
+void Simulation::save_checkpoint(const std::string& filename)
+{
+    CheckpointHeader header = {};
+    std::memcpy(header.magic, CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+    header.version = CHECKPOINT_VERSION;
+    header.num_cpus = this->cores.size();
+    header.num_processes = this->processes.size();
+    header.event_num = this->event_num;
+    this->flags.scheduler.copy(header.algorithm, sizeof(header.algorithm));
+    header.time_slice = this->flags.time_slice;
+    header.thread_switch_overhead = this->thread_switch_overhead;
+    header.process_switch_overhead = this->process_switch_overhead;
+    header.scheduler_time_slice = this->scheduler->time_slice;
+    header.scheduler_time = this->scheduler->current_time;
+    header.events_handled = this->events_handled;
+    header.total_time = this->system_stats.total_time;
+    header.dispatch_time = this->system_stats.dispatch_time;
+    header.total_idle_time = this->system_stats.total_idle_time;
+    header.migrations = this->system_stats.migrations;
+    header.dispatches_coalesced = this->system_stats.dispatches_coalesced;
+
+    // Threads are numbered in the order they are kept in
+    std::unordered_map<const Thread*, int32_t> numbers;
+    std::vector<CheckpointThread> threads;
+    for (const auto &entry : this->processes)
+    {
+        for (const auto &thread : entry.second->threads)
+        {
+            numbers[thread.get()] = threads.size();
+
+            // A thread's previous state is only set once it leaves NEW
+            ThreadState previous_state = (thread->current_state == NEW) ? NEW : thread->previous_state;
+            threads.push_back({thread->start_time, thread->end_time, thread->service_time, thread->io_time,
+                               thread->state_change_time, thread->current_state, previous_state, thread->next_burst,
+                               thread->remaining_time, thread->burst_estimate, thread->mlfq_time, thread->last_queue_level,
+                               thread->prev_service_time, thread->last_cpu, thread->run_queue, 0, thread->stride_pass});
         }
+    }
+    auto number = [&](const std::shared_ptr<Thread> &thread) { return thread ? numbers.at(thread.get()) : -1; };
+    header.num_threads = threads.size();
+
+    std::vector<EventHandle> pending = this->events.pending_events();
+    std::sort(pending.begin(), pending.end(), [&](EventHandle handle_1, EventHandle handle_2) {
+        const Event &event_1 = this->events.event(handle_1);
+        const Event &event_2 = this->events.event(handle_2);
+        return std::tie(event_1.time, event_1.event_num) < std::tie(event_2.time, event_2.event_num);
+    });
+
+    // Cores find their burst event by its slot in the event queue
+    std::unordered_map<unsigned int, int32_t> event_indices;
+    std::vector<CheckpointEvent> events;
+    for (EventHandle handle : pending)
+    {
+        const Event &event = this->events.event(handle);
+        event_indices[handle.slot] = events.size();
+        events.push_back({event.type, event.time, event.event_num, number(event.thread), event.cpu, 0});
+    }
+    header.num_events = events.size();
+
+    std::vector<CheckpointCore> cores;
+    for (const Core &core : this->cores)
+    {
+        int32_t burst_event = this->events.pending(core.burst_event) ? event_indices.at(core.burst_event.slot) : -1;
+        cores.push_back({number(core.active_thread), number(core.prev_thread), core.time_slice, burst_event,
+                         core.burst_end_time, core.idle_since, core.running_dispatcher_invoked, 0,
+                         this->system_stats.cpu_service_times[core.core_id],
+                         this->system_stats.cpu_dispatch_times[core.core_id],
+                         this->system_stats.cpu_idle_times[core.core_id]});
+    }
+
+    std::vector<uint32_t> ready;
+    for (const auto &thread : this->scheduler->ready_threads())
+    {
+        ready.push_back(numbers.at(thread.get()));
+    }
+    header.num_ready = ready.size();
+    if (ready.size() % 2 != 0)
+    {
+        ready.push_back(0);
+    }
+
+    std::vector<uint64_t> idle_intervals(this->system_stats.idle_intervals.begin(), this->system_stats.idle_intervals.end());
+    header.num_idle_buckets = idle_intervals.size();
+
+    std::string temporary = filename + ".tmp";
+    std::ofstream output(temporary, std::ios::binary | std::ios::trunc);
+    if (!output)
+    {
+        throw std::runtime_error("Unable to create " + temporary + ".");
+    }
+
+    output.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    output.write(reinterpret_cast<const char *>(cores.data()), cores.size() * sizeof(CheckpointCore));
+    output.write(reinterpret_cast<const char *>(threads.data()), threads.size() * sizeof(CheckpointThread));
+    output.write(reinterpret_cast<const char *>(events.data()), events.size() * sizeof(CheckpointEvent));
+    output.write(reinterpret_cast<const char *>(ready.data()), ready.size() * sizeof(uint32_t));
+    output.write(reinterpret_cast<const char *>(idle_intervals.data()), idle_intervals.size() * sizeof(uint64_t));
+    output.close();
+
+    if (!output)
+    {
+        throw std::runtime_error("Unable to write " + temporary + ".");
+    }
+    if (std::rename(temporary.c_str(), filename.c_str()) != 0)
+    {
+        throw std::runtime_error("Unable to replace " + filename + ".");
+    }
+}
+
+void Simulation::restore_checkpoint(Workload workload, const std::string& filename)
+{
+    auto fail = [&](const std::string &message) {
+        throw std::runtime_error(filename + ": " + message);
+    };
+
+    MappedFile file(filename);
+    const char *data = file.data();
+    size_t size = file.size();
+
+    if (size < sizeof(CheckpointHeader) || std::memcmp(data, CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC)) != 0)
+    {
+        fail("not a checkpoint");
+    }
+    const CheckpointHeader &header = *reinterpret_cast<const CheckpointHeader *>(data);
+    if (header.version != CHECKPOINT_VERSION)
+    {
+        fail("unsupported checkpoint version " + std::to_string(header.version) +
+             " (expected " + std::to_string(CHECKPOINT_VERSION) + ")");
+    }
+
+    // The table sizes come from 32 bit counts, so none of these can overflow
+    uint64_t cores_offset = sizeof(CheckpointHeader);
+    uint64_t threads_offset = cores_offset + uint64_t(header.num_cpus) * sizeof(CheckpointCore);
+    uint64_t events_offset = threads_offset + uint64_t(header.num_threads) * sizeof(CheckpointThread);
+    uint64_t ready_offset = events_offset + uint64_t(header.num_events) * sizeof(CheckpointEvent);
+    uint64_t idle_offset = (ready_offset + uint64_t(header.num_ready) * sizeof(uint32_t) + 7) & ~uint64_t(7);
+    if (idle_offset + uint64_t(header.num_idle_buckets) * sizeof(uint64_t) != size)
+    {
+        fail("the tables do not match the size of the file");
+    }
+
+    std::string algorithm(header.algorithm, strnlen(header.algorithm, sizeof(header.algorithm)));
+    if (algorithm != this->flags.scheduler || header.time_slice != this->flags.time_slice)
+    {
+        fail("the checkpoint was saved with a different algorithm or time slice");
+    }
+    if (header.num_cpus != this->cores.size())
+    {
+        fail("the checkpoint was saved with a different number of CPUs");
+    }
+
+    this->thread_switch_overhead = workload.thread_switch_overhead;
+    this->process_switch_overhead = workload.process_switch_overhead;
+    for (const auto &process : workload.processes)
+    {
+        this->processes[process->process_id] = process;
+    }
+
+    std::vector<std::shared_ptr<Thread>> threads;
+    for (const auto &entry : this->processes)
+    {
+        threads.insert(threads.end(), entry.second->threads.begin(), entry.second->threads.end());
+    }
+    if (header.num_processes != this->processes.size() || header.num_threads != threads.size() ||
+        header.thread_switch_overhead != this->thread_switch_overhead || header.process_switch_overhead != this->process_switch_overhead)
+    {
+        fail("the checkpoint was saved from a different simulation file");
+    }
 
-        // If this event triggered a state change, print it out.
-        if (event->thread && event->thread->current_state != event->thread->previous_state)
+    auto thread_at = [&](int64_t index) -> std::shared_ptr<Thread> {
+        if (index == -1)
         {
-            this->logger.print_state_transition(event, event->thread->previous_state, event->thread->current_state);
+            return nullptr;
         }
-        else if (event->scheduling_decision->thread)
+        if (index < 0 || uint64_t(index) >= threads.size())
         {
-            this->logger.print_verbose(event, event->scheduling_decision->thread, event->scheduling_decision->explanation);
+            fail("thread " + std::to_string(index) + " does not exist");
         }
+        return threads[index];
+    };
 
-        this->system_stats.total_time = event->time;
-        event.reset();
+    const CheckpointThread *saved_threads = reinterpret_cast<const CheckpointThread *>(data + threads_offset);
+    for (size_t index = 0; index < threads.size(); index++)
+    {
+        const CheckpointThread &saved = saved_threads[index];
+        Thread &thread = *threads[index];
+        if (saved.current_state < NEW || saved.current_state > EXIT || saved.previous_state < NEW || saved.previous_state > EXIT ||
+            saved.next_burst > thread.num_bursts)
+        {
+            fail("thread " + std::to_string(index) + " is not in a valid state");
+        }
+
+        thread.start_time = saved.start_time;
+        thread.end_time = saved.end_time;
+        thread.service_time = saved.service_time;
+        thread.io_time = saved.io_time;
+        thread.state_change_time = saved.state_change_time;
+        thread.current_state = (ThreadState)saved.current_state;
+        thread.previous_state = (ThreadState)saved.previous_state;
+        thread.next_burst = saved.next_burst;
+        thread.remaining_time = saved.remaining_time;
+        thread.burst_estimate = saved.burst_estimate;
+        thread.mlfq_time = saved.mlfq_time;
+        thread.last_queue_level = saved.last_queue_level;
+        thread.prev_service_time = saved.prev_service_time;
+        thread.last_cpu = saved.last_cpu;
+        thread.run_queue = saved.run_queue;
+        thread.stride_pass = saved.stride_pass;
     }
-    // We are done!
 
-    std::cout << "SIMULATION COMPLETED!\n\n";
+    // Events keep their event_nums, so they are handled in the same order
+    const CheckpointEvent *saved_events = reinterpret_cast<const CheckpointEvent *>(data + events_offset);
+    std::vector<EventHandle> handles;
+    for (uint32_t index = 0; index < header.num_events; index++)
+    {
+        const CheckpointEvent &saved = saved_events[index];
+        if (saved.type < THREAD_ARRIVED || saved.type > DISPATCHER_INVOKED || saved.cpu < -1 || saved.cpu >= int32_t(header.num_cpus))
+        {
+            fail("event " + std::to_string(index) + " is not a valid event");
+        }
+        handles.push_back(this->add_event(Event((EventType)saved.type, saved.time, saved.event_num, thread_at(saved.thread), saved.cpu)));
+    }
 
-    for (auto entry : this->processes)
+    const CheckpointCore *saved_cores = reinterpret_cast<const CheckpointCore *>(data + cores_offset);
+    for (Core &core : this->cores)
     {
-        this->logger.print_per_thread_metrics(entry.second);
+        const CheckpointCore &saved = saved_cores[core.core_id];
+        if (saved.burst_event < -1 || saved.burst_event >= int32_t(handles.size()))
+        {
+            fail("CPU " + std::to_string(core.core_id) + " refers to an event that does not exist");
+        }
+
+        core.active_thread = thread_at(saved.active_thread);
+        core.prev_thread = thread_at(saved.prev_thread);
+        core.time_slice = saved.time_slice;
+        core.burst_event = (saved.burst_event == -1) ? EventHandle() : handles[saved.burst_event];
+        core.burst_end_time = saved.burst_end_time;
+        core.idle_since = saved.idle_since;
+        core.running_dispatcher_invoked = saved.running_dispatcher_invoked != 0;
+        this->system_stats.cpu_service_times[core.core_id] = saved.service_time;
+        this->system_stats.cpu_dispatch_times[core.core_id] = saved.dispatch_time;
+        this->system_stats.cpu_idle_times[core.core_id] = saved.idle_time;
+    }
+
+    const uint32_t *saved_ready = reinterpret_cast<const uint32_t *>(data + ready_offset);
+    std::vector<std::shared_ptr<Thread>> ready;
+    for (uint32_t index = 0; index < header.num_ready; index++)
+    {
+        ready.push_back(thread_at(saved_ready[index]));
+    }
+    this->scheduler->restore_ready_threads(ready);
+    this->scheduler->time_slice = header.scheduler_time_slice;
+    this->scheduler->current_time = header.scheduler_time;
+
+    const uint64_t *saved_idle_intervals = reinterpret_cast<const uint64_t *>(data + idle_offset);
+    this->system_stats.idle_intervals.assign(saved_idle_intervals, saved_idle_intervals + header.num_idle_buckets);
+    this->system_stats.total_time = header.total_time;
+    this->system_stats.dispatch_time = header.dispatch_time;
+    this->system_stats.total_idle_time = header.total_idle_time;
+    this->system_stats.migrations = header.migrations;
+    this->system_stats.dispatches_coalesced = header.dispatches_coalesced;
+
+    this->event_num = header.event_num;
+    this->events_handled = header.events_handled;
+}
+
+void Simulation::checkpoint_if_due()
+{
+    size_t reached = this->flags.checkpoint_ticks ? this->system_stats.total_time : this->events_handled;
+    if (reached < this->next_checkpoint)
+    {
+        return;
     }
 
-    logger.print_simulation_metrics(this->calculate_statistics());
+    std::string filename = this->flags.checkpoint_file;
+    if (filename == "")
+    {
+        filename = this->flags.filename + ".checkpoint";
+    }
+    this->save_checkpoint(filename);
+
+    this->next_checkpoint = (reached / this->flags.checkpoint_every + 1) * this->flags.checkpoint_every;
+}
+
+namespace
+{
+    // A final scheduler that keeps the default get_next_thread_for() is called straight
+    // through get_next_thread(), which the default would only reach through the vtable
+    template <class SchedulerT>
+    SchedulingDecision next_thread_for(SchedulerT& scheduler, int cpu)
+    {
+        if constexpr (!std::is_same<SchedulerT, Scheduler>::value &&
+                      std::is_same<decltype(&SchedulerT::get_next_thread_for), decltype(&Scheduler::get_next_thread_for)>::value)
+        {
+            return scheduler.get_next_thread();
+        }
+        else
+        {
+            return scheduler.get_next_thread_for(cpu);
+        }
+    }
+}
+
+void Simulation::simulate()
+{
+    // A restored simulation saves its next checkpoint where the one it was restored from would have
+    if (this->flags.checkpoint_every > 0)
+    {
+        size_t reached = this->flags.checkpoint_ticks ? this->system_stats.total_time : this->events_handled;
+        this->next_checkpoint = (reached / this->flags.checkpoint_every + 1) * this->flags.checkpoint_every;
+    }
+
+    Scheduler& scheduler = *this->scheduler;
+    if (auto fcfs = dynamic_cast<FCFSScheduler*>(&scheduler))
+    {
+        this->simulate_with(*fcfs);
+    }
+    else if (auto spn = dynamic_cast<SPNScheduler*>(&scheduler))
+    {
+        this->simulate_with(*spn);
+    }
+    else if (auto rr = dynamic_cast<RRScheduler*>(&scheduler))
+    {
+        this->simulate_with(*rr);
+    }
+    else if (auto priority = dynamic_cast<PRIORITYScheduler*>(&scheduler))
+    {
+        this->simulate_with(*priority);
+    }
+    else if (auto mlfq = dynamic_cast<MLFQScheduler*>(&scheduler))
+    {
+        this->simulate_with(*mlfq);
+    }
+    else
+    {
+        this->simulate_with(scheduler);
+    }
+
+    // Every CPU is idle once there is nothing left to do
+    for (const Core& core : this->cores)
+    {
+        this->end_idle(core.core_id, this->system_stats.total_time);
+    }
+}
+
+template <class SchedulerT>
+void Simulation::simulate_with(SchedulerT& scheduler)
+{
+    this->stream_arrivals();
+    while (!this->events.empty())
+    {
+        if (this->flags.batch_events)
+        {
+            // Events added while handling the batch come after it even at the same time, since
+            // their event_nums are higher, so they are left for the next batch
+            this->events.pop_batch(this->batch);
+            scheduler.current_time = this->batch.front().time;
+            while (this->batch_next < this->batch.size())
+            {
+                Event& event = this->batch[this->batch_next++];
+                this->handle_event(scheduler, event);
+            }
+            this->batch.clear();
+            this->batch_next = 0;
+        }
+        else
+        {
+            Event event = this->events.pop();
+            scheduler.current_time = event.time;
+            this->handle_event(scheduler, event);
+        }
+
+        if (this->flags.checkpoint_every > 0)
+        {
+            this->checkpoint_if_due();
+        }
+
+        this->stream_arrivals();
+    }
+}
+
+template <class SchedulerT>
+void Simulation::handle_event(SchedulerT& scheduler, Event& event)
+{
+    // Invoke the appropriate method in the simulation for the given event type.
+
+    switch (event.type)
+    {
+    case THREAD_ARRIVED:
+        this->handle_thread_arrived(scheduler, event);
+        break;
+
+    case THREAD_DISPATCH_COMPLETED:
+    case PROCESS_DISPATCH_COMPLETED:
+        this->handle_dispatch_completed(event);
+        break;
+
+    case CPU_BURST_COMPLETED:
+        this->handle_cpu_burst_completed(event);
+        break;
+
+    case IO_BURST_COMPLETED:
+        this->handle_io_burst_completed(scheduler, event);
+        break;
+    case THREAD_COMPLETED:
+        this->handle_thread_completed(event);
+        break;
+
+    case THREAD_PREEMPTED:
+        this->handle_thread_preempted(scheduler, event);
+        break;
+
+    case DISPATCHER_INVOKED:
+        this->handle_dispatcher_invoked(scheduler, event);
+        break;
+    }
+
+    // If this event triggered a state change, print it out.
+    if (event.thread && event.thread->current_state != event.thread->previous_state)
+    {
+        this->logger.print_state_transition(event, event.thread->previous_state, event.thread->current_state);
+    }
+
+    this->system_stats.total_time = event.time;
+    this->events_handled++;
 }
 
 //==============================================================================
 // Event-handling methods
 //==============================================================================
 
-void Simulation::handle_thread_arrived(const std::shared_ptr<Event> event)
+template <class SchedulerT>
+void Simulation::handle_thread_arrived(SchedulerT& scheduler, Event& event)
 {
-    event->thread->set_ready(event->time);
-    scheduler->add_to_ready_queue(event->thread);
+    event.thread->set_ready(event.time);
+    scheduler.add_to_ready_queue(event.thread);
 
-    // If no active thread, run the scheduler!
-    if (!active_thread && !running_dispatcher_invoked)
+    // If a CPU has no active thread, run the scheduler! Otherwise the new thread may preempt one.
+    if (!wake_idle_cpu(scheduler, event.thread, event.time))
     {
-        running_dispatcher_invoked = true;
-        auto new_event = Event(DISPATCHER_INVOKED, event->time, event_num++, nullptr, nullptr);
-        add_event(std::make_shared<Event>(new_event));
+        preempt_for(scheduler, event.thread, event.time);
     }
 }
 
-void Simulation::handle_dispatch_completed(const std::shared_ptr<Event> event)
+void Simulation::handle_dispatch_completed(Event& event)
 {
-    event->thread->set_running(event->time);
+    event.thread->set_running(event.time);
 
     /*
     Determine the appropriate next even and generate it as adequate
@@ -139,219 +627,321 @@ void Simulation::handle_dispatch_completed(const std::shared_ptr<Event> event)
             - If yes next event is an CPU Burst Complete
             - If no next event is a Thread Complete
     */
-    std::shared_ptr<Event> new_event = nullptr;
-    if (scheduler->time_slice == -1 || event->thread->get_next_burst(CPU)->length <= scheduler->time_slice)
+    int time_slice = cores[event.cpu].time_slice;
+    if (time_slice == -1 || event.thread->get_next_burst(CPU) <= time_slice)
     {
-        int thread_service_time = event->thread->get_next_burst(CPU)->length;
-        event->thread->pop_next_burst(CPU);
+        // The burst is popped when it completes, since the thread may still be preempted
+        int thread_service_time = event.thread->get_next_burst(CPU);
 
-        if (event->thread->get_next_burst(IO))
+        if (event.thread->peek_next_burst(IO))
         {
-            new_event = std::make_shared<Event>(Event(CPU_BURST_COMPLETED, event->time + thread_service_time, event_num++, active_thread, nullptr));
+            schedule_burst_end(Event(CPU_BURST_COMPLETED, event.time + thread_service_time, event_num++, event.thread, event.cpu));
         }
         else
         {
-            new_event = std::make_shared<Event>(Event(THREAD_COMPLETED, event->time + thread_service_time, event_num++, active_thread, nullptr));
+            schedule_burst_end(Event(THREAD_COMPLETED, event.time + thread_service_time, event_num++, event.thread, event.cpu));
         }
     }
     else
     {
-        new_event = std::make_shared<Event>(Event(THREAD_PREEMPTED, event->time + scheduler->time_slice, event_num++, active_thread, nullptr));
+        schedule_burst_end(Event(THREAD_PREEMPTED, event.time + time_slice, event_num++, event.thread, event.cpu));
     }
-
-    add_event(new_event);
 }
 
-void Simulation::handle_cpu_burst_completed(const std::shared_ptr<Event> event)
+void Simulation::handle_cpu_burst_completed(Event& event)
 {
-    event->thread->set_blocked(event->time);
+    system_stats.cpu_service_times[event.cpu] += event.time - event.thread->state_change_time;
+    event.thread->pop_next_burst(CPU);
+    event.thread->set_blocked(event.time);
 
     // Just finished using the CPU, run the scheduler!
-    auto new_event = Event(DISPATCHER_INVOKED, event->time, event_num++, nullptr, nullptr);
-    add_event(std::make_shared<Event>(new_event));
+    invoke_dispatcher(event.cpu, event.time);
 
-    new_event = Event(IO_BURST_COMPLETED, event->time + event->thread->get_next_burst(IO)->length, event_num++, event->thread, nullptr);
-    add_event(std::make_shared<Event>(new_event));
+    add_event(Event(IO_BURST_COMPLETED, event.time + event.thread->get_next_burst(IO), event_num++, event.thread));
 }
 
-void Simulation::handle_io_burst_completed(const std::shared_ptr<Event> event)
+template <class SchedulerT>
+void Simulation::handle_io_burst_completed(SchedulerT& scheduler, Event& event)
 {
-    // Run the scheduler if we don't have an active thread.
-    if (active_thread == nullptr)
+    event.thread->set_ready(event.time);
+    event.thread->pop_next_burst(IO);
+    scheduler.add_to_ready_queue(event.thread);
+
+    // Run the scheduler if a CPU doesn't have an active thread. Otherwise the thread may preempt one.
+    if (!wake_idle_cpu(scheduler, event.thread, event.time))
     {
-        auto new_event = Event(DISPATCHER_INVOKED, event->time, event_num++, nullptr, nullptr);
-        add_event(std::make_shared<Event>(new_event));
+        preempt_for(scheduler, event.thread, event.time);
     }
-
-    event->thread->set_ready(event->time);
-    event->thread->pop_next_burst(IO);
-    scheduler->add_to_ready_queue(event->thread);
 }
 
-void Simulation::handle_thread_completed(const std::shared_ptr<Event> event)
+void Simulation::handle_thread_completed(Event& event)
 {
-    event->thread->set_finished(event->time);
+    system_stats.cpu_service_times[event.cpu] += event.time - event.thread->state_change_time;
+    event.thread->pop_next_burst(CPU);
+    event.thread->set_finished(event.time);
+    if (this->stream_trace)
+    {
+        // Streamed threads may be freed once this event is done with them, so count them now
+        add_stats(event.thread);
+    }
 
     // Just finished using the CPU, run the scheduler!
-    auto new_event = Event(DISPATCHER_INVOKED, event->time, event_num++, nullptr, nullptr);
-    add_event(std::make_shared<Event>(new_event));
+    invoke_dispatcher(event.cpu, event.time);
 }
 
-void Simulation::handle_thread_preempted(const std::shared_ptr<Event> event)
+template <class SchedulerT>
+void Simulation::handle_thread_preempted(SchedulerT& scheduler, Event& event)
 {
-    event->thread->set_ready(event->time);
-    event->thread->get_next_burst(CPU)->update_time(scheduler->time_slice);
-    scheduler->add_to_ready_queue(event->thread);
-    auto new_event = Event(DISPATCHER_INVOKED, event->time, event_num++, nullptr, nullptr);
-    add_event(std::make_shared<Event>(new_event));
+    // The thread used up its time slice, or less of it if it was preempted by preempt_for
+    int ran = event.time - event.thread->state_change_time;
+    system_stats.cpu_service_times[event.cpu] += ran;
+    event.thread->set_ready(event.time);
+    event.thread->update_next_burst(ran);
+    scheduler.add_to_ready_queue(event.thread);
+    invoke_dispatcher(event.cpu, event.time);
 }
 
-void Simulation::handle_dispatcher_invoked(const std::shared_ptr<Event> event)
+template <class SchedulerT>
+void Simulation::handle_dispatcher_invoked(SchedulerT& scheduler, Event& event)
 {
-    if (active_thread)
+    Core& core = cores[event.cpu];
+
+    if (core.active_thread)
     {
-        prev_thread = active_thread;
+        core.prev_thread = core.active_thread;
     }
 
-    event->scheduling_decision = scheduler->get_next_thread();
-    running_dispatcher_invoked = false;
+    SchedulingDecision decision = next_thread_for(scheduler, event.cpu);
+    core.running_dispatcher_invoked = false;
 
     // If we have a thread, then make either PROCESS_DISPATCH_COMPLETED or THREAD_DISPATCH_COMPLETED
-    // based on whether the previous thread running is the same process as this one
-    if (event->scheduling_decision->thread)
+    // based on whether the previous thread running on this CPU is the same process as this one
+    if (decision.thread)
     {
-        std::shared_ptr<Event> new_event = nullptr;
-        active_thread = event->scheduling_decision->thread;
+        this->logger.print_scheduling_decision(event, decision);
+        core.active_thread = decision.thread;
+        if (core.active_thread->last_cpu != -1 && core.active_thread->last_cpu != core.core_id)
+        {
+            system_stats.migrations++;
+        }
+        core.active_thread->last_cpu = core.core_id;
+        core.time_slice = scheduler.time_slice;
 
-        if (!prev_thread || active_thread->process_id != prev_thread->process_id)
+        int overhead;
+        EventType type;
+        if (!core.prev_thread || core.active_thread->process_id != core.prev_thread->process_id)
         {
-            system_stats.dispatch_time += process_switch_overhead;
-            new_event = std::make_shared<Event>(Event(PROCESS_DISPATCH_COMPLETED, event->time + process_switch_overhead, event_num++, active_thread, event->scheduling_decision));
+            overhead = process_switch_overhead;
+            type = PROCESS_DISPATCH_COMPLETED;
         }
         else
         {
-            system_stats.dispatch_time += thread_switch_overhead;
-            new_event = std::make_shared<Event>(Event(THREAD_DISPATCH_COMPLETED, event->time + thread_switch_overhead, event_num++, active_thread, event->scheduling_decision));
+            overhead = thread_switch_overhead;
+            type = THREAD_DISPATCH_COMPLETED;
         }
 
-        // Regardless of whether this is PROCESS_DISPATCH_COMPLETED or THREAD_DISPATCH_COMPLETED,
-        // always add to the queue
-        add_event(new_event);
+        system_stats.dispatch_time += overhead;
+        system_stats.cpu_dispatch_times[event.cpu] += overhead;
+        add_event(Event(type, event.time + overhead, event_num++, core.active_thread, event.cpu));
     }
     else
     {
 
         // No threads in the ready queue ==> no threads to be scheduled
         // Thus, the CPU will become _idle_
-        active_thread = nullptr;
-        return;
+        core.active_thread = nullptr;
+        core.idle_since = event.time;
     }
-}
 
-//==============================================================================
-// Utility methods
-//==============================================================================
+    // Rebalancing may have given threads to idle CPUs, which would otherwise never look at their run queues
+    woken_cpus.clear();
+    scheduler.take_woken_cpus(woken_cpus);
+    for (int cpu : woken_cpus)
+    {
+        if (cpu != event.cpu && cores[cpu].idle())
+        {
+            end_idle(cpu, event.time);
+            invoke_dispatcher(cpu, event.time);
+        }
+    }
+}
 
-SystemStats Simulation::calculate_statistics()
+void Simulation::invoke_dispatcher(int cpu, unsigned int time)
 {
-    /*
-        TODO: Calculate the following system statistics:
-            - thread_counts[4]
-            - avg_thread_response_times[4]
-            - avg_thread_turnaround_times[4]
-            - total_service_time
-            - total_io_time
-            - total_idle_time
-            - cpu_utilization
-            - cpu_efficiency
-    */
+    Core& core = cores[cpu];
 
-    iterate_threads();
-    this->system_stats.total_idle_time = system_stats.total_time - system_stats.total_service_time - system_stats.dispatch_time;
-    this->system_stats.cpu_utilization = (double(system_stats.total_time - system_stats.total_idle_time) / system_stats.total_time) * 100;
-    this->system_stats.cpu_efficiency = ((double)system_stats.total_service_time / (double)system_stats.total_time) * 100;
-    return this->system_stats;
+    // Nothing can become ready before the dispatcher would run, so do what it would have done with an empty ready queue
+    if (flags.coalesce_dispatches && scheduler->empty() && !scheduler->dispatch_when_empty() && !events_pending_at(time))
+    {
+        if (core.active_thread)
+        {
+            core.prev_thread = core.active_thread;
+        }
+        core.active_thread = nullptr;
+        core.idle_since = time;
+        system_stats.dispatches_coalesced++;
+        return;
+    }
+
+    core.running_dispatcher_invoked = true;
+    add_event(Event(DISPATCHER_INVOKED, time, event_num++, nullptr, cpu));
 }
 
-void Simulation::add_event(std::shared_ptr<Event> event)
+bool Simulation::events_pending_at(unsigned int time)
 {
-    if (event != nullptr)
+    // The rest of the batch being handled is all at the current time
+    if (batch_next < batch.size() || (!events.empty() && events.next_time() <= time))
     {
-        this->events.push(event);
+        return true;
     }
+
+    if (stream_trace && next_arrival < stream_trace->header().num_threads)
+    {
+        const BinaryTraceThread &entry = stream_trace->thread(stream_trace->arrival(next_arrival));
+        return (unsigned int)entry.arrival_time <= time;
+    }
+    return false;
 }
 
-void Simulation::read_file(const std::string filename)
+template <class SchedulerT>
+bool Simulation::wake_idle_cpu(SchedulerT& scheduler, std::shared_ptr<Thread> thread, unsigned int time)
 {
-    std::ifstream input_file(filename.c_str());
+    idle_cpus.clear();
+    for (const Core& core : cores)
+    {
+        if (core.idle())
+        {
+            idle_cpus.push_back(core.core_id);
+        }
+    }
 
-    if (!input_file)
+    if (idle_cpus.empty())
     {
-        std::cerr << "Unable to open simulation file: " << filename << std::endl;
-        throw(std::logic_error("Bad file."));
+        return false;
     }
 
-    int num_processes;
+    int cpu = scheduler.select_cpu(thread, idle_cpus);
+    end_idle(cpu, time);
+    invoke_dispatcher(cpu, time);
+    return true;
+}
 
-    input_file >> num_processes >> this->thread_switch_overhead >> this->process_switch_overhead;
+void Simulation::end_idle(int cpu, unsigned int time)
+{
+    size_t interval = time - cores[cpu].idle_since;
+    system_stats.cpu_idle_times[cpu] += interval;
+    system_stats.total_idle_time += interval;
 
-    for (int proc = 0; proc < num_processes; ++proc)
+    if (interval > 0)
     {
-        auto process = read_process(input_file);
-
-        this->processes[process->process_id] = process;
+        // The bucket is the position of the interval's highest set bit
+        size_t bucket = 63 - __builtin_clzll(interval);
+        if (bucket >= system_stats.idle_intervals.size())
+        {
+            system_stats.idle_intervals.resize(bucket + 1, 0);
+        }
+        system_stats.idle_intervals[bucket]++;
     }
 }
 
-std::shared_ptr<Process> Simulation::read_process(std::istream &input)
+template <class SchedulerT>
+void Simulation::preempt_for(SchedulerT& scheduler, std::shared_ptr<Thread> thread, unsigned int time)
 {
-    int process_id, priority;
-    int num_threads;
-
-    input >> process_id >> priority >> num_threads;
+    Core* victim = nullptr;
+    for (Core& core : cores)
+    {
+        // Only a thread that is running, and not about to come off the core anyway, can be preempted
+        if (!events.pending(core.burst_event) || core.burst_end_time <= time || core.running_dispatcher_invoked)
+        {
+            continue;
+        }
 
-    auto process = std::make_shared<Process>(process_id, (ProcessPriority)priority);
+        if (scheduler.should_preempt(core.active_thread, thread) &&
+            (victim == nullptr || scheduler.should_preempt_first(core.active_thread, victim->active_thread)))
+        {
+            victim = &core;
+        }
+    }
 
-    // iterate over the threads
-    for (int thread_id = 0; thread_id < num_threads; ++thread_id)
+    if (victim != nullptr)
     {
-        process->threads.emplace_back(read_thread(input, thread_id, process_id, (ProcessPriority)priority));
+        events.cancel(victim->burst_event);
+        schedule_burst_end(Event(THREAD_PREEMPTED, time, event_num++, victim->active_thread, victim->core_id));
     }
+}
 
-    return process;
+void Simulation::schedule_burst_end(Event&& event)
+{
+    Core& core = cores[event.cpu];
+    core.burst_end_time = event.time;
+    core.burst_event = add_event(std::move(event));
 }
 
-std::shared_ptr<Thread> Simulation::read_thread(std::istream &input, int thread_id, int process_id, ProcessPriority priority)
+//==============================================================================
+// Utility methods
+//==============================================================================
+
+SystemStats Simulation::calculate_statistics()
 {
-    // Stuff
-    int arrival_time;
-    int num_cpu_bursts;
+    /*
+        TODO: Calculate the following system statistics:
+            - thread_counts[4]
+            - avg_thread_response_times[4]
+            - avg_thread_turnaround_times[4]
+            - total_service_time
+            - total_io_time
+            - total_idle_time
+            - cpu_utilization
+            - cpu_efficiency
+    */
 
-    input >> arrival_time >> num_cpu_bursts;
+    iterate_threads();
+    scheduler->report_stats(this->system_stats);
 
-    auto thread = std::make_shared<Thread>(arrival_time, thread_id, process_id, priority);
+    // With more than one CPU, the idle time and percentages are out of the time available on all of them
+    // The idle times were added up as the simulation went
+    size_t cpu_time = system_stats.total_time * cores.size();
+    this->system_stats.cpu_utilization = (double(cpu_time - system_stats.total_idle_time) / cpu_time) * 100;
+    this->system_stats.cpu_efficiency = ((double)system_stats.total_service_time / (double)cpu_time) * 100;
 
-    for (int n = 0, burst_length; n < num_cpu_bursts * 2 - 1; ++n)
+    this->system_stats.cpu_utilizations.clear();
+    for (size_t cpu = 0; cpu < cores.size(); cpu++)
     {
-        input >> burst_length;
+        size_t idle_time = system_stats.cpu_idle_times[cpu];
+        this->system_stats.cpu_utilizations.push_back((double(system_stats.total_time - idle_time) / system_stats.total_time) * 100);
+    }
+    return this->system_stats;
+}
 
-        BurstType burst_type = (n % 2 == 0) ? BurstType::CPU : BurstType::IO;
+EventHandle Simulation::add_event(Event&& event)
+{
+    return this->events.push(std::move(event));
+}
 
-        thread->bursts.push(std::make_shared<Burst>(burst_type, burst_length));
+Workload Simulation::read_file(const std::string filename)
+{
+    auto file = std::make_shared<const MappedFile>(filename);
+    if (BinaryTrace::matches(file->data(), file->size()))
+    {
+        // The threads' bursts point straight into the mapping, which they keep alive
+        return read_binary_trace(file, filename);
     }
 
-    this->events.push(std::make_shared<Event>(EventType::THREAD_ARRIVED, thread->arrival_time, this->event_num, thread, nullptr));
-    this->event_num++;
-
-    return thread;
+    TraceParser parser(file->data(), file->data() + file->size(), filename);
+    return parser.read_workload();
 }
 
 // Iterates through all threads and adds their stats
 void Simulation::iterate_threads()
 {
-    // Iterate through akk the threads
+    // Iterate through akk the threads. Streamed threads were already counted as they finished.
     for (const auto &pair : this->processes)
     {
+        if (this->stream_trace)
+        {
+            break;
+        }
+
         std::shared_ptr<Process> process = pair.second;
         for (const auto &thread : process->threads)
         {
@@ -375,6 +965,18 @@ void Simulation::add_stats(std::shared_ptr<Thread> thread)
 {
     system_stats.total_service_time += thread->service_time;
     system_stats.total_io_time += thread->io_time;
+    if (thread->deadline() != -1)
+    {
+        int tardiness = thread->tardiness();
+        system_stats.deadline_threads++;
+        system_stats.total_tardiness += tardiness;
+        system_stats.max_tardiness = std::max(system_stats.max_tardiness, tardiness);
+        system_stats.tardiness_histogram[SystemStats::tardiness_bucket(tardiness)]++;
+        if (tardiness > 0)
+        {
+            system_stats.deadline_misses++;
+        }
+    }
     if (thread->priority == ProcessPriority::SYSTEM)
     {
         system_stats.thread_counts[0]++;
@@ -7,17 +7,21 @@
 #include <memory>
 #include <queue>
 #include <string>
+#include <vector>
 
 #include "algorithms/scheduling_algorithm.hpp"
+#include "types/core/core.hpp"
 #include "types/process/process.hpp"
 #include "types/thread/thread.hpp"
+#include "types/workload/workload.hpp"
 #include "types/system_stats/system_stats.hpp"
 #include "types/event/event.hpp"
+#include "types/event/event_queue.hpp"
 
+#include "utilities/binary_trace/binary_trace.hpp"
 #include "utilities/flags/flags.hpp"
 #include "utilities/logger/logger.hpp"
-
-using EventQueue = std::priority_queue<std::shared_ptr<Event>, std::vector<std::shared_ptr<Event>>, EventComparator>;
+#include "utilities/mapped_file/mapped_file.hpp"
 
 /*
     Simulation:
@@ -48,26 +52,11 @@ public:
     std::shared_ptr<Scheduler> scheduler;
 
     /*
-        active_thread:
-            The thread that is currently on the CPU. If no thread is on the
-            CPU, it should point to nullptr.
-    */
-    std::shared_ptr<Thread> active_thread = nullptr;
-
-    /*
-        prev_thread:
-            The thread that was previously on the CPU, or nullptr if there was
-            not thread previously on the CPU.
+        cores:
+            The simulated CPUs, each with its own active thread and dispatcher. There is
+            one core unless the user asks for more with the -c, --cpus flag.
     */
-    std::shared_ptr<Thread> prev_thread = nullptr;
-
-    /*
-     * Set to true if we've added a dispatcher_invoked thread into the queue
-     * but it has *NOT* yet been removed.
-     *
-     * Otherwise, we could run DISPATCHER_INVOKED multiple times if threads arrive at the same time.
-     */
-    bool running_dispatcher_invoked = false; 
+    std::vector<Core> cores;
 
     /*
         thread_switch_overhead:
@@ -88,6 +77,20 @@ public:
     */
     unsigned int event_num = 0;
 
+    /*
+        events_handled:
+            How many events the simulation has handled so far, including the ones handled
+            before the checkpoint it was restored from.
+    */
+    size_t events_handled = 0;
+
+    /*
+        next_checkpoint:
+            With the -k, --checkpoint_every flag, the number of events handled, or the time,
+            at which the next checkpoint is saved.
+    */
+    size_t next_checkpoint = 0;
+
     /*
         events:
             Our priority queue of events. This is what we add new events to,
@@ -95,6 +98,48 @@ public:
     */
     EventQueue events;
 
+    /*
+        batch / batch_next:
+            With the -B, --batch_events flag, the events at the current time that were taken off
+            the event queue together, and the index of the next one to handle.
+    */
+    std::vector<Event> batch;
+    size_t batch_next = 0;
+
+    /*
+        woken_cpus:
+            The CPUs the scheduler gave threads to while choosing for another CPU, kept between
+            dispatches so that asking for them does not allocate.
+    */
+    std::vector<int> woken_cpus;
+
+    /*
+        idle_cpus:
+            The idle CPUs that wake_idle_cpu() offers the scheduler, kept between arrivals so
+            that finding them does not allocate.
+    */
+    std::vector<int> idle_cpus;
+
+    /*
+        stream_trace:
+            When streaming (the -S, --stream flag), the mapped binary simulation file that
+            threads are read in from as the simulation reaches their arrival times. Null
+            otherwise.
+    */
+    std::shared_ptr<BinaryTrace> stream_trace;
+
+    /*
+        stream_processes:
+            When streaming, the processes in the order of the file's process table.
+    */
+    std::vector<std::shared_ptr<Process>> stream_processes;
+
+    /*
+        next_arrival:
+            When streaming, how many threads have been read in, in arrival order.
+    */
+    size_t next_arrival = 0;
+
     /*
         system_stats:
             A SystemStats object for storing various simulation statistics.
@@ -134,12 +179,96 @@ public:
 
     /*
         run():
-            The main loop of the simulation. This function reads in the
-            specified simulation file, populates all the required data structure,
-            and then begins the next-event simulation for the CPU scheduler.
+            Runs the whole simulation. This function reads in the specified simulation
+            file, simulates it, and then prints the output the user asked for.
     */
     void run();
 
+    /*
+        load_workload(workload):
+            Takes ownership of the processes in the workload and adds a THREAD_ARRIVED
+            event for each of their threads, in the order they appear in the simulation file.
+    */
+    void load_workload(Workload workload);
+
+    /*
+        save_checkpoint(filename):
+            Saves the state of the simulation between two events as a checkpoint (see
+            utilities/checkpoint/checkpoint.hpp). The checkpoint is written next to the file and
+            then renamed over it, so a run that is stopped part way through leaves the last one
+            whole. Throws a std::runtime_error if the file cannot be written.
+    */
+    void save_checkpoint(const std::string& filename);
+
+    /*
+        restore_checkpoint(workload, filename):
+            Takes ownership of the processes in the workload, like load_workload(), and then
+            puts them, the event queue, the ready queue, the CPUs and the statistics back the
+            way they were when the checkpoint was saved. The workload must be the same one.
+
+            Errors are thrown as a std::runtime_error naming the checkpoint, like:
+                input.checkpoint: the checkpoint was saved with a different algorithm
+    */
+    void restore_checkpoint(Workload workload, const std::string& filename);
+
+    /*
+        checkpoint_if_due():
+            Called between events. Saves a checkpoint if the number of events handled, or the
+            time, has reached next_checkpoint, and moves next_checkpoint on.
+    */
+    void checkpoint_if_due();
+
+    /*
+        open_stream(filename):
+            Maps a binary simulation file to stream its threads in. Creates the processes
+            right away, but leaves reading in the threads to stream_arrivals().
+
+            Every arrival gets its thread's index in the file as its event_num, which is the
+            event_num load_workload() would have given it, so streaming does not change the
+            order that events are handled in.
+    */
+    void open_stream(const std::string& filename);
+
+    /*
+        stream_arrivals():
+            When streaming, reads in every thread that arrives no later than the next pending
+            event and adds its THREAD_ARRIVED event. Does nothing otherwise.
+
+            Threads are only kept by their process if per-thread metrics were asked for, so
+            otherwise a thread (and its bursts) is freed once it has finished.
+    */
+    void stream_arrivals();
+
+    /*
+        simulate():
+            The main loop of the simulation. Runs the next-event simulation for the
+            CPU scheduler until there are no events left. Prints nothing unless verbose is set.
+
+            Checks the scheduler's type once and runs simulate_with() for it, so that the
+            FCFS, SPN, RR, PRIORITY and MLFQ schedulers are called directly rather than
+            through the vtable on every event. Any other scheduler runs through the base class.
+    */
+    void simulate();
+
+    /*
+        simulate_with(scheduler):
+            The main loop itself, for a scheduler of a known type. The handlers below that
+            call the scheduler take it in the same way.
+
+            With the -B, --batch_events flag, every event at the next time is taken off the
+            event queue at once and handled in event_num order before going back to the queue.
+    */
+    template <class SchedulerT>
+    void simulate_with(SchedulerT& scheduler);
+
+    /*
+        handle_event(scheduler, event):
+            Calls the handler for the event's type, prints the state transition or scheduling
+            decision it made, and moves the clock to the event's time.
+    */
+    template <class SchedulerT>
+    void handle_event(SchedulerT& scheduler, Event& event);
+
     /*
         handle_*:
             These functions are handler functions that are called for each
@@ -153,40 +282,35 @@ public:
             You will have to draw diagrams for what most of these functions do for
             Deliverable 1 of this project, and then for Deliverable 2 you will have to implement
             them.
+
+            The handlers that call the scheduler take it as well, as the type simulate_with() was run for.
     */
-    void handle_thread_arrived(const std::shared_ptr<Event> event);
+    template <class SchedulerT>
+    void handle_thread_arrived(SchedulerT& scheduler, Event& event);
 
-    void handle_dispatch_completed(const std::shared_ptr<Event> event);
+    void handle_dispatch_completed(Event& event);
 
-    void handle_cpu_burst_completed(const std::shared_ptr<Event> event);
+    void handle_cpu_burst_completed(Event& event);
 
-    void handle_io_burst_completed(const std::shared_ptr<Event> event);
+    template <class SchedulerT>
+    void handle_io_burst_completed(SchedulerT& scheduler, Event& event);
 
-    void handle_thread_completed(const std::shared_ptr<Event> event);
+    void handle_thread_completed(Event& event);
 
-    void handle_thread_preempted(const std::shared_ptr<Event> event);
+    template <class SchedulerT>
+    void handle_thread_preempted(SchedulerT& scheduler, Event& event);
 
-    void handle_dispatcher_invoked(const std::shared_ptr<Event> event);
+    template <class SchedulerT>
+    void handle_dispatcher_invoked(SchedulerT& scheduler, Event& event);
 
     /*
         read_file(filename):
-            This function reads in the simulation file, as specified by filename. If filename is
-            blank, then it reads in from stdin.
-    */
-    void read_file(const std::string filename);
-
-    /*
-        read_process(input):
-            Reads in a process from the simulation file. Called by read_file
-            for each process that is provided in the simulation file.
+            This function reads in the simulation file, as specified by filename, and returns
+            its contents. Files are memory-mapped. Binary simulation files are used in place,
+            with the threads' bursts pointing into the mapping. Text files are parsed by a
+            TraceParser, which reports where any errors are.
     */
-    std::shared_ptr<Process> read_process(std::istream& input);
-
-    /*
-        read_thread(input, thread_id, process_id, priority):
-            Reads in a thread from the simulation file. Called by read_process
-    */
-    std::shared_ptr<Thread> read_thread(std::istream& input, int thread_id, int process_id, ProcessPriority priority);
+    static Workload read_file(const std::string filename);
 
     /* TODO
         calculate_statistics():
@@ -197,10 +321,60 @@ public:
 
     /*
         add_event(event):
-            Checks to see if the event is not a nullptr,
-            then adds it to the event queue.
+            Moves the event into the event queue, and returns a handle that can cancel it.
+    */
+    EventHandle add_event(Event&& event);
+
+    /*
+        invoke_dispatcher(cpu, time):
+            Adds a DISPATCHER_INVOKED event for the given CPU at the given time.
+
+            When dispatches are coalesced (the -d, --coalesce_dispatches flag), and the ready
+            queue is empty with nothing else left to happen at this time, the dispatcher could
+            only find no thread, so the CPU is left idle right away instead.
+    */
+    void invoke_dispatcher(int cpu, unsigned int time);
+
+    /*
+        events_pending_at(time):
+            Returns true if any event, including a streamed arrival that has not been read in
+            yet, is still to be handled at or before the given time.
+    */
+    bool events_pending_at(unsigned int time);
+
+    /*
+        wake_idle_cpu(scheduler, thread, time):
+            Called when a thread becomes ready. If any CPU is idle, lets the scheduler
+            pick one of them and invokes its dispatcher. Returns false if no CPU was idle.
+    */
+    template <class SchedulerT>
+    bool wake_idle_cpu(SchedulerT& scheduler, std::shared_ptr<Thread> thread, unsigned int time);
+
+    /*
+        end_idle(cpu, time):
+            Called when an idle CPU's dispatcher is invoked, and for every CPU at the end of the
+            simulation. Adds the time since the CPU went idle to the idle times and to the
+            histogram of idle intervals.
+    */
+    void end_idle(int cpu, unsigned int time);
+
+    /*
+        preempt_for(scheduler, thread, time):
+            Called when a thread becomes ready and no CPU is idle. Asks the scheduler whether
+            the thread should preempt any of the running threads. Of the CPUs whose threads it
+            should preempt, the scheduler's should_preempt_first() picks the one running the
+            worst thread, such as the one with the latest deadline, and that CPU's pending burst
+            event is replaced by cancelling it and adding a THREAD_PREEMPTED event at the given time.
+    */
+    template <class SchedulerT>
+    void preempt_for(SchedulerT& scheduler, std::shared_ptr<Thread> thread, unsigned int time);
+
+    /*
+        schedule_burst_end(event):
+            Adds the event that takes the active thread off its core, and remembers it on the
+            core so that preempt_for can cancel it.
     */
-    void add_event(std::shared_ptr<Event> event);
+    void schedule_burst_end(Event&& event);
 
     // My methods below
 
@@ -0,0 +1,128 @@
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "simulation/simulation.hpp"
+#include "utilities/benchmark/benchmark.hpp"
+
+/*
+    Measures the whole simulation loop for the algorithms that simulate() calls without going
+    through the vtable, on two CPUs and the same generated workload. Loading the workload is
+    done before timing, so only the events are counted.
+
+    FCFS is also run with batched events on both event queues, on a lockstep workload where
+    every thread has the same bursts so that hundreds of events land on the same tick, and on
+    a sparse workload, where the CPUs are often idle, with and without coalesced dispatches.
+    Both are reported in the events the uncoalesced run handles.
+*/
+
+namespace {
+
+const int REPETITIONS = 5;
+
+std::string make_temporary_file() {
+    char filename[] = "/tmp/cpu-sim-bench-XXXXXX";
+    int fd = mkstemp(filename);
+    if (fd == -1) {
+        throw std::runtime_error("Unable to create a temporary file.");
+    }
+    close(fd);
+    return filename;
+}
+
+Workload generate_workload(int num_processes, int num_threads, int num_bursts) {
+    std::string filename = make_temporary_file();
+    write_random_trace(filename, num_processes, num_threads, num_bursts);
+    Workload workload = Simulation::read_file(filename);
+    std::remove(filename.c_str());
+    return workload;
+}
+
+// Threads that all arrive at 0 with the same bursts, on as many CPUs, stay in step
+Workload lockstep_workload(int num_threads, int num_bursts) {
+    std::string filename = make_temporary_file();
+    {
+        std::ofstream output(filename);
+        output << "1 0 0\n\n0 0 " << num_threads << "\n";
+        for (int thread = 0; thread < num_threads; ++thread) {
+            output << "0 " << num_bursts << "\n";
+            for (int burst = 0; burst < num_bursts - 1; ++burst) {
+                output << "4 50\n";
+            }
+            output << "4\n\n";
+        }
+    }
+    Workload workload = Simulation::read_file(filename);
+    std::remove(filename.c_str());
+    return workload;
+}
+
+FlagOptions options(const std::string& algorithm, int time_slice, int num_cpus = 2) {
+    FlagOptions flags;
+    flags.scheduler = algorithm;
+    flags.time_slice = time_slice;
+    flags.num_cpus = num_cpus;
+    return flags;
+}
+
+void time_simulation(const std::string& label, const Workload& workload, const FlagOptions& flags) {
+    std::vector<Simulation> simulations;
+    for (int run = 0; run < REPETITIONS; ++run) {
+        simulations.emplace_back(flags);
+        simulations.back().load_workload(workload.clone());
+    }
+
+    size_t run = 0;
+    double seconds = time_best_of(REPETITIONS, [&] {
+        simulations[run++].simulate();
+    });
+
+    // Every run handles the same events, and using the count keeps the loop from being optimized away
+    size_t saved = simulations.front().system_stats.dispatches_coalesced;
+    size_t events = simulations.front().event_num + saved;
+    if (events == 0) {
+        throw std::logic_error("The simulation handled no events.");
+    }
+
+    if (flags.coalesce_dispatches) {
+        report(label + ", " + std::to_string(saved) + " dispatches coalesced", seconds, events, "events");
+    } else {
+        report(label, seconds, events, "events");
+    }
+}
+
+}
+
+BENCHMARK(simulation_loop) {
+    Workload workload = generate_workload(100, 20, 20);
+    time_simulation("FCFS", workload, options("FCFS", -1));
+    time_simulation("SPN", workload, options("SPN", -1));
+    time_simulation("RR", workload, options("RR", 50));
+    time_simulation("PRIORITY", workload, options("PRIORITY", -1));
+    time_simulation("MLFQ", workload, options("MLFQ", -1));
+
+    FlagOptions batched = options("FCFS", -1);
+    batched.batch_events = true;
+    time_simulation("FCFS, batched", workload, batched);
+
+    FlagOptions wheel = options("FCFS", -1);
+    wheel.event_queue = "wheel";
+    time_simulation("FCFS, wheel", workload, wheel);
+    wheel.batch_events = true;
+    time_simulation("FCFS, wheel, batched", workload, wheel);
+
+    Workload lockstep = lockstep_workload(256, 200);
+    FlagOptions lockstep_flags = options("FCFS", -1, 256);
+    time_simulation("lockstep FCFS", lockstep, lockstep_flags);
+    lockstep_flags.batch_events = true;
+    time_simulation("lockstep FCFS, batched", lockstep, lockstep_flags);
+
+    Workload sparse = generate_workload(4, 1, 2000);
+    FlagOptions coalesced = options("FCFS", -1);
+    time_simulation("sparse FCFS", sparse, coalesced);
+    coalesced.coalesce_dispatches = true;
+    time_simulation("sparse FCFS", sparse, coalesced);
+}
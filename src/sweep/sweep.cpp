@@ -0,0 +1,309 @@
+#include "sweep/sweep.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <getopt.h>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+#include "algorithms/mlfq/mlfq_algorithm.hpp"
+#include "algorithms/scheduler_factory.hpp"
+#include "simulation/simulation.hpp"
+#include "types/workload/workload.hpp"
+#include "utilities/flags/flags.hpp"
+#include "utilities/thread_pool/thread_pool.hpp"
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+void print_sweep_usage() {
+    std::cout <<
+        "Usage: cpu-sim sweep [options] filename\n"
+        "\n"
+        "Runs the simulation file with every combination of the given options, in parallel,\n"
+        "and prints the results as CSV with one row per combination.\n"
+        "\n"
+        "Options\n"
+        "   -h, --help:\n"
+        "       Print this help message and exit.\n"
+        "\n"
+        "   -a, --algorithms <list>:\n"
+        "       Comma-separated algorithms to run (default: all of them).\n"
+        "\n"
+        "   -s, --slices <list>:\n"
+        "       Time slices for the algorithms that take one, like 1..32 or 1,2,4,8\n"
+        "       (default: each algorithm's default time slice).\n"
+        "\n"
+        "   -c, --cpus <list>:\n"
+        "       Numbers of CPUs to simulate, in the same format as --slices (default 1).\n"
+        "\n"
+        "   -l, --mlfq_levels <list>:\n"
+        "       Numbers of MLFQ levels, in the same format as --slices (default 10).\n"
+        "\n"
+        "   -q, --mlfq_quanta <list>:\n"
+        "       The quantum of each MLFQ level, highest level first, like 1,2,4,8 (default: 2^i ticks in level i).\n"
+        "\n"
+        "   -j, --jobs <value>:\n"
+        "       How many simulations to run at once (default: the number of host cores).\n"
+        "\n"
+        "   -e, --event_queue <queue>:\n"
+        "       The event queue backend to use, heap (default) or wheel.\n";
+}
+
+bool parse_int_list(const std::string& text, std::vector<int>& values) {
+    std::stringstream items(text);
+    std::string item;
+
+    while (std::getline(items, item, ',')) {
+        try {
+            size_t range = item.find("..");
+            int first, last;
+            if (range == std::string::npos) {
+                first = last = std::stoi(item);
+            } else {
+                first = std::stoi(item.substr(0, range));
+                last = std::stoi(item.substr(range + 2));
+            }
+            if (first <= 0 || last < first) {
+                return false;
+            }
+            for (int value = first; value <= last; ++value) {
+                values.push_back(value);
+            }
+        } catch (...) {
+            return false;
+        }
+    }
+
+    return !values.empty();
+}
+
+std::string csv_field(const std::string& text) {
+    if (text.find_first_of(",\"\r\n") == std::string::npos) {
+        return text;
+    }
+
+    std::string quoted = "\"";
+    for (char c : text) {
+        if (c == '"') {
+            quoted += '"';
+        }
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+int parse_sweep_flags(int argc, char* const argv[], SweepOptions& options) {
+    static struct option flag_options[] = {
+        {"algorithms",  required_argument,  0, 'a'},
+        {"slices",      required_argument,  0, 's'},
+        {"cpus",        required_argument,  0, 'c'},
+        {"mlfq_levels", required_argument,  0, 'l'},
+        {"mlfq_quanta", required_argument,  0, 'q'},
+        {"jobs",        required_argument,  0, 'j'},
+        {"event_queue", required_argument,  0, 'e'},
+        {"help",        no_argument,        0, 'h'},
+        {0, 0, 0, 0}
+    };
+
+    int option_index;
+    int flag_char;
+
+    options.jobs = std::max(1u, std::thread::hardware_concurrency());
+
+    while (true) {
+        flag_char = getopt_long(argc, argv, "-a:s:c:l:q:j:e:h", flag_options, &option_index);
+
+        if (flag_char == -1) {
+            break;
+        }
+
+        switch (flag_char) {
+            case 'a': {
+                std::stringstream names(optarg);
+                std::string name;
+                while (std::getline(names, name, ',')) {
+                    std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+                    const auto& valid = available_algorithms();
+                    if (std::find(valid.begin(), valid.end(), name) == valid.end()) {
+                        return 1;
+                    }
+                    options.algorithms.push_back(name);
+                }
+                break;
+            }
+
+            case 's':
+                if (!parse_int_list(optarg, options.time_slices)) { return 1; }
+                break;
+
+            case 'c':
+                if (!parse_int_list(optarg, options.cpu_counts)) { return 1; }
+                break;
+
+            case 'l':
+                if (!parse_int_list(optarg, options.mlfq_levels)) { return 1; }
+                break;
+
+            case 'q':
+                if (!parse_int_list(optarg, options.mlfq_quanta)) { return 1; }
+                break;
+
+            case 'j':
+                try {
+                    options.jobs = std::stoi(optarg);
+                    if (options.jobs <= 0) { return 1; }
+                } catch (...) {
+                    return 1;
+                }
+                break;
+
+            case 'e':
+                if (!get_event_queue(optarg, options.event_queue)) { return 1; }
+                break;
+
+            case 1:
+                options.filename = optarg;
+                break;
+
+            default:
+                return 1;
+        }
+    }
+
+    if (options.filename == "") {
+        return 1;
+    }
+
+    if (options.algorithms.empty()) {
+        options.algorithms = available_algorithms();
+    }
+
+    if (options.time_slices.empty()) {
+        options.time_slices.push_back(-1);
+    }
+
+    if (options.cpu_counts.empty()) {
+        options.cpu_counts.push_back(1);
+    }
+
+    if (options.mlfq_levels.empty()) {
+        options.mlfq_levels.push_back(0);
+    }
+
+    return 0;
+}
+
+int run_sweep(int argc, char* const argv[]) {
+    SweepOptions options;
+
+    if (parse_sweep_flags(argc, argv, options) != 0) {
+        print_sweep_usage();
+        return 1;
+    }
+
+    // Every run gets its own clone of this, so the file is only read once
+    Workload workload;
+    try {
+        workload = Simulation::read_file(options.filename);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    std::vector<SweepRun> runs;
+    for (const auto& algorithm : options.algorithms) {
+        for (int num_cpus : options.cpu_counts) {
+            if (algorithm == "MLFQ") {
+                for (int mlfq_levels : options.mlfq_levels) {
+                    SweepRun run;
+                    run.algorithm = algorithm;
+                    run.num_cpus = num_cpus;
+                    run.mlfq_levels = mlfq_levels;
+                    runs.push_back(run);
+                }
+                continue;
+            }
+            if (!takes_time_slice(algorithm)) {
+                SweepRun run;
+                run.algorithm = algorithm;
+                run.num_cpus = num_cpus;
+                runs.push_back(run);
+                continue;
+            }
+            for (int time_slice : options.time_slices) {
+                SweepRun run;
+                run.algorithm = algorithm;
+                run.time_slice = time_slice;
+                run.num_cpus = num_cpus;
+                runs.push_back(run);
+            }
+        }
+    }
+
+    {
+        ThreadPool pool(std::min<size_t>(options.jobs, runs.size()));
+
+        for (auto& run : runs) {
+            SweepRun* result = &run;
+            pool.submit([result, &workload, &options] {
+                try {
+                    FlagOptions flags;
+                    flags.scheduler = result->algorithm;
+                    flags.time_slice = result->time_slice;
+                    flags.num_cpus = result->num_cpus;
+                    flags.event_queue = options.event_queue;
+                    if (result->mlfq_levels != -1) {
+                        flags.mlfq_levels = result->mlfq_levels;
+                        flags.mlfq_quanta = options.mlfq_quanta;
+                    }
+
+                    Simulation simulation(flags);
+                    simulation.load_workload(workload.clone());
+                    simulation.simulate();
+                    result->stats = simulation.calculate_statistics();
+                } catch (const std::exception& e) {
+                    result->error = e.what();
+                } catch (...) {
+                    result->error = "unknown error";
+                }
+            });
+        }
+
+        pool.wait();
+    }
+
+    std::cout << "algorithm,time_slice,cpus,mlfq_levels,total_time,service_time,io_time,dispatch_time,idle_time,"
+                 "cpu_utilization,cpu_efficiency,avg_response_time,avg_turnaround_time,deadline_misses,error\n";
+
+    for (const auto& run : runs) {
+        const SystemStats& stats = run.stats;
+
+        size_t thread_count = 0;
+        double response_time = 0.0;
+        double turnaround_time = 0.0;
+        for (int i = SYSTEM; i <= BATCH; ++i) {
+            thread_count += stats.thread_counts[i];
+            response_time += stats.avg_thread_response_times[i] * stats.thread_counts[i];
+            turnaround_time += stats.avg_thread_turnaround_times[i] * stats.thread_counts[i];
+        }
+        if (thread_count != 0) {
+            response_time /= thread_count;
+            turnaround_time /= thread_count;
+        }
+
+        // Show how many levels MLFQ actually had, which the quanta decide if they were given
+        int mlfq_levels = run.mlfq_levels;
+        if (mlfq_levels == 0) {
+            mlfq_levels = options.mlfq_quanta.empty() ? MLFQScheduler::DEFAULT_LEVELS : (int) options.mlfq_quanta.size();
+        }
+
+        std::cout << fmt::format("{},{},{},{},{},{},{},{},{},{:.2f},{:.2f},{:.2f},{:.2f},{},{}\n",
+            run.algorithm, run.time_slice, run.num_cpus, mlfq_levels, stats.total_time, stats.total_service_time,
+            stats.total_io_time, stats.dispatch_time, stats.total_idle_time, stats.cpu_utilization,
+            stats.cpu_efficiency, response_time, turnaround_time, stats.deadline_misses, csv_field(run.error));
+    }
+
+    return 0;
+}
@@ -0,0 +1,137 @@
+#ifndef SWEEP_HPP
+#define SWEEP_HPP
+
+#include <string>
+#include <vector>
+
+#include "types/system_stats/system_stats.hpp"
+
+/*
+    SweepOptions:
+        The flags for the sweep mode, which runs the same simulation file with
+        every combination of the given algorithms, time slices, CPU counts and MLFQ levels.
+*/
+
+class SweepOptions {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        filename:
+            The simulation file to run.
+    */
+    std::string filename = "";
+
+    /*
+        algorithms:
+            The algorithms to run. Set with the -a, --algorithms flag.
+    */
+    std::vector<std::string> algorithms;
+
+    /*
+        time_slices:
+            The time slices to run the algorithms that take one with. Algorithms that do
+            not take a time slice run once. Set with the -s, --slices flag.
+    */
+    std::vector<int> time_slices;
+
+    /*
+        cpu_counts:
+            The numbers of CPUs to simulate. Set with the -c, --cpus flag.
+    */
+    std::vector<int> cpu_counts;
+
+    /*
+        mlfq_levels:
+            The numbers of levels to run MLFQ with, or just 0 for the default. Other algorithms
+            run once. Set with the -l, --mlfq_levels flag.
+    */
+    std::vector<int> mlfq_levels;
+
+    /*
+        mlfq_quanta:
+            The quantum of each MLFQ level, or empty for the default quanta. Set with the
+            -q, --mlfq_quanta flag.
+    */
+    std::vector<int> mlfq_quanta;
+
+    /*
+        jobs:
+            How many simulations to run at the same time. Set with the -j, --jobs flag.
+    */
+    int jobs = 1;
+
+    /*
+        event_queue:
+            The event queue backend to use. Set with the -e, --event_queue flag.
+    */
+    std::string event_queue = "heap";
+};
+
+/*
+    SweepRun:
+        One configuration of a sweep, and its results once it has run.
+*/
+
+class SweepRun {
+public:
+    std::string algorithm;
+
+    int time_slice = -1;
+
+    int num_cpus = 1;
+
+    // The number of MLFQ levels, or 0 for the default, and -1 for other algorithms
+    int mlfq_levels = -1;
+
+    /*
+        stats:
+            The statistics of the finished simulation.
+    */
+    SystemStats stats;
+
+    /*
+        error:
+            Why the simulation failed, or empty if it succeeded.
+    */
+    std::string error;
+};
+
+/*
+    print_sweep_usage():
+        Prints information about how to use the sweep mode.
+*/
+void print_sweep_usage();
+
+/*
+    parse_sweep_flags(argc, argv, options):
+        Parses the flags after "sweep", populating the passed in options. Returns
+        a non-zero value if they are invalid.
+*/
+int parse_sweep_flags(int argc, char* const argv[], SweepOptions& options);
+
+/*
+    parse_int_list(text, values):
+        Parses a comma-separated list of positive integers and inclusive ranges,
+        like "1..4,8,16". Returns false if it is invalid.
+*/
+bool parse_int_list(const std::string& text, std::vector<int>& values);
+
+/*
+    csv_field(text):
+        Returns the text as a CSV field, quoted with any quotes doubled if it holds a comma,
+        a quote or a line break.
+*/
+std::string csv_field(const std::string& text);
+
+/*
+    run_sweep(argc, argv):
+        The entry point for "cpu-sim sweep ...". Reads the simulation file once, runs every
+        configuration on a pool of threads, and prints one CSV row per configuration.
+*/
+int run_sweep(int argc, char* const argv[]);
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef CORE_HPP
+#define CORE_HPP
+
+#include <memory>
+
+#include "types/event/event_queue.hpp"
+#include "types/thread/thread.hpp"
+
+/*
+    Core:
+        A simple class representing a single simulated CPU. Each core runs at most one
+        thread at a time and has its own dispatcher.
+*/
+
+class Core {
+public:
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        core_id:
+            The index of this core within the simulation.
+    */
+    int core_id = 0;
+
+    /*
+        active_thread:
+            The thread that is currently on this core. If no thread is on the
+            core, it should point to nullptr.
+    */
+    std::shared_ptr<Thread> active_thread = nullptr;
+
+    /*
+        prev_thread:
+            The thread that was previously on this core, or nullptr if there was
+            not thread previously on the core. Used to decide between a thread switch
+            and a process switch.
+    */
+    std::shared_ptr<Thread> prev_thread = nullptr;
+
+    /*
+        running_dispatcher_invoked:
+            Set to true if we've added a DISPATCHER_INVOKED event for this core into the queue
+            but it has *NOT* yet been removed.
+
+            Otherwise, we could run DISPATCHER_INVOKED multiple times if threads arrive at the same time.
+    */
+    bool running_dispatcher_invoked = false;
+
+    /*
+        time_slice:
+            The time slice the scheduler gave the active thread when it was dispatched, or -1
+            if it should not be preempted.
+    */
+    int time_slice = -1;
+
+    /*
+        burst_event / burst_end_time:
+            The handle and time of the CPU_BURST_COMPLETED, THREAD_COMPLETED or THREAD_PREEMPTED
+            event that will take the active thread off the core. The handle stops being pending
+            once that event is popped, or when it is cancelled because the thread was preempted early.
+    */
+    EventHandle burst_event;
+    unsigned int burst_end_time = 0;
+
+    /*
+        idle_since:
+            When the core last went idle. Cores start out idle at time 0.
+    */
+    unsigned int idle_since = 0;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        Core(core_id):
+            A constructor for a new, idle core.
+    */
+    Core(int core_id) : core_id(core_id) {}
+
+    /*
+        idle():
+            Returns true if the core has no thread and no pending dispatcher.
+    */
+    bool idle() const { return !active_thread && !running_dispatcher_invoked; }
+};
+
+#endif
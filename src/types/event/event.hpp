@@ -3,9 +3,9 @@
 
 #include <memory>
 #include <iostream>
+#include <utility>
 #include <vector>
 
-#include "types/scheduling_decision/scheduling_decision.hpp"
 #include "types/thread/thread.hpp"
 #include "types/enums.hpp"
 
@@ -51,11 +51,11 @@ public:
     std::shared_ptr<Thread> thread;
 
     /*
-        scheduling_decision:
-            The associated scheduling decision for this event. We may get set this when we create
-            a new event within Simulation::handle_dispatcher_invoked(event).
+        cpu:
+            The index of the CPU this event happens on, or -1 if the event is not tied to a
+            CPU (like THREAD_ARRIVED or IO_BURST_COMPLETED).
     */
-    std::shared_ptr<SchedulingDecision> scheduling_decision;
+    int cpu = -1;
 
     //==================================================
     //  Member functions
@@ -65,42 +65,17 @@ public:
         Event():
             The class constructor. Takes in an EventType representing the type of event it should be,
             a time representing when this event is scheduled to occur, an integer indicating which event this is,
-            a Thread if one is associated with this event (or nullptr if one is not), and a SchedulingDecision if
-            one is associated with this event (or nullptr if one is not).
+            a Thread if one is associated with this event (or nullptr if one is not), and the CPU the event
+            happens on.
     */
-    Event(EventType type, unsigned int time, unsigned int event_num, std::shared_ptr<Thread> thread, std::shared_ptr<SchedulingDecision> sd):
-        type(type), time(time), event_num(event_num), thread(thread), scheduling_decision(sd) {}
+    Event(EventType type, unsigned int time, unsigned int event_num, std::shared_ptr<Thread> thread, int cpu = -1):
+        type(type), time(time), event_num(event_num), thread(std::move(thread)), cpu(cpu) {}
 
     /*
-        ~Event():
-            The class destructor.
+        Event():
+            A default constructor, used by the event queue for its storage.
     */
-    ~Event() {}
-};
-
-struct EventComparator{
-        /*
-            A comparator for the priority queue to correctly order the events.
-
-            Fundamentally, we want to order the events based on their time. But what
-            happens when we have multiple events with the same time? The priority queue is not
-            "stable", that is to say, it does not preserve the order in which you insert elements
-            into the queue. So we need to do some additional checks before simple returning a comparison
-            of event times.
-
-            We ideally we would compare against time, but if the two times are equal, then we look at the
-            events' number.
-
-            We use > (greater than) as the comparison so that the smaller elements will rise to the top, which is what we want.
-        */
-    bool operator()(const std::shared_ptr<Event> event_1, const std::shared_ptr<Event> event_2) {
-        if(event_1->time == event_2->time) {
-            return event_1->event_num > event_2->event_num;
-        }
-        else {
-            return event_1->time > event_2->time;
-        }
-    }
+    Event() {}
 };
 
 #endif
@@ -0,0 +1,339 @@
+#include "types/event/event_queue.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+EventQueue::EventQueue(EventQueueBackend backend) : backend(backend) {
+    if (backend == WHEEL_QUEUE) {
+        buckets.resize(WHEEL_SIZE);
+        bucket_heads.resize(WHEEL_SIZE, 0);
+        occupied.resize(WHEEL_SIZE / 64, 0);
+    }
+}
+
+EventHandle EventQueue::push(Event&& event) {
+    if (backend == WHEEL_QUEUE && event.time < wheel_time) {
+        throw std::logic_error("Attempted to schedule an event in the past.");
+    }
+
+    unsigned int slot;
+
+    if (free_slots.empty()) {
+        slot = slots.size();
+        slots.push_back(std::move(event));
+        slot_generations.push_back(1);
+    } else {
+        slot = free_slots.back();
+        free_slots.pop_back();
+        slots[slot] = std::move(event);
+    }
+
+    HeapEntry entry = {slots[slot].time, slots[slot].event_num, slot, slot_generations[slot]};
+
+    if (backend == HEAP_QUEUE || entry.time - wheel_time >= WHEEL_SIZE) {
+        heap_push(entry);
+    } else {
+        wheel_insert(entry);
+    }
+
+    return {slot, entry.generation};
+}
+
+bool EventQueue::cancel(EventHandle handle) {
+    if (!pending(handle)) {
+        return false;
+    }
+
+    // Let go of the event's thread now; its entry is skipped once it reaches the front
+    slots[handle.slot] = Event();
+    release(handle.slot);
+    tombstones++;
+
+    if (tombstones >= COMPACT_THRESHOLD && tombstones * 2 > heap.size() + wheel_count) {
+        compact();
+    }
+
+    return true;
+}
+
+std::vector<EventHandle> EventQueue::pending_events() const {
+    std::vector<EventHandle> handles;
+    handles.reserve(size());
+
+    auto add = [&](const HeapEntry& entry) {
+        if (live(entry)) {
+            handles.push_back({entry.slot, entry.generation});
+        }
+    };
+
+    for (const HeapEntry& entry : heap) {
+        add(entry);
+    }
+    for (unsigned int index = 0; index < buckets.size(); ++index) {
+        for (size_t position = bucket_heads[index]; position < buckets[index].size(); ++position) {
+            add(buckets[index][position]);
+        }
+    }
+
+    return handles;
+}
+
+const Event& EventQueue::top() {
+    return slots[next_entry().slot];
+}
+
+Event EventQueue::pop() {
+    HeapEntry entry = next_entry();
+
+    if (backend == HEAP_QUEUE) {
+        heap_pop();
+    } else {
+        bucket_pop(entry.time & (WHEEL_SIZE - 1));
+    }
+
+    Event event = std::move(slots[entry.slot]);
+    release(entry.slot);
+    return event;
+}
+
+size_t EventQueue::pop_batch(std::vector<Event>& batch) {
+    unsigned int time = next_time();
+    size_t count = batch.size();
+
+    if (backend == HEAP_QUEUE) {
+        while (!heap.empty() && heap.front().time == time) {
+            take(heap_pop(), batch);
+        }
+        return batch.size() - count;
+    }
+
+    // Heap entries at this time are pulled onto the wheel, so its bucket holds the whole batch
+    wheel_advance();
+    unsigned int index = wheel_time & (WHEEL_SIZE - 1);
+    std::vector<HeapEntry>& bucket = buckets[index];
+    for (size_t position = bucket_heads[index]; position < bucket.size(); ++position) {
+        take(bucket[position], batch);
+    }
+
+    wheel_count -= bucket.size() - bucket_heads[index];
+    bucket.clear();
+    bucket_heads[index] = 0;
+    occupied[index / 64] &= ~(uint64_t(1) << (index % 64));
+
+    return batch.size() - count;
+}
+
+void EventQueue::take(const HeapEntry& entry, std::vector<Event>& batch) {
+    if (!live(entry)) {
+        tombstones--;
+        return;
+    }
+    batch.push_back(std::move(slots[entry.slot]));
+    release(entry.slot);
+}
+
+unsigned int EventQueue::next_time() {
+    if (empty()) {
+        throw std::runtime_error("Attempted to read from an empty event queue.");
+    }
+
+    drop_cancelled();
+
+    if (backend == HEAP_QUEUE) {
+        return heap.front().time;
+    }
+
+    return wheel_next_time();
+}
+
+const EventQueue::HeapEntry& EventQueue::next_entry() {
+    if (empty()) {
+        throw std::runtime_error("Attempted to read from an empty event queue.");
+    }
+
+    drop_cancelled();
+
+    if (backend == HEAP_QUEUE) {
+        return heap.front();
+    }
+
+    wheel_advance();
+    unsigned int index = wheel_time & (WHEEL_SIZE - 1);
+    return buckets[index][bucket_heads[index]];
+}
+
+void EventQueue::release(unsigned int slot) {
+    // Skip 0 if the generation wraps around, since default handles use it
+    if (++slot_generations[slot] == 0) {
+        slot_generations[slot] = 1;
+    }
+    free_slots.push_back(slot);
+}
+
+void EventQueue::drop_cancelled() {
+    while (tombstones > 0) {
+        // Heap entries are always later than the entries on the wheel
+        if (backend == WHEEL_QUEUE && wheel_count > 0) {
+            unsigned int index = wheel_next_time() & (WHEEL_SIZE - 1);
+            if (live(buckets[index][bucket_heads[index]])) {
+                return;
+            }
+            bucket_pop(index);
+        } else {
+            if (heap.empty() || live(heap.front())) {
+                return;
+            }
+            heap_pop();
+        }
+        tombstones--;
+    }
+}
+
+void EventQueue::compact() {
+    heap.erase(std::remove_if(heap.begin(), heap.end(), [this](const HeapEntry& entry) { return !live(entry); }), heap.end());
+    for (size_t index = heap.size() / 2; index-- > 0;) {
+        sift_down(index);
+    }
+
+    if (backend == WHEEL_QUEUE) {
+        wheel_count = 0;
+        for (unsigned int index = 0; index < WHEEL_SIZE; ++index) {
+            std::vector<HeapEntry>& bucket = buckets[index];
+            bucket.erase(bucket.begin(), bucket.begin() + bucket_heads[index]);
+            bucket.erase(std::remove_if(bucket.begin(), bucket.end(), [this](const HeapEntry& entry) { return !live(entry); }), bucket.end());
+            bucket_heads[index] = 0;
+            wheel_count += bucket.size();
+            if (bucket.empty()) {
+                occupied[index / 64] &= ~(uint64_t(1) << (index % 64));
+            }
+        }
+    }
+
+    tombstones = 0;
+}
+
+//==============================================================================
+// Binary heap
+//==============================================================================
+
+void EventQueue::heap_push(const HeapEntry& entry) {
+    heap.push_back(entry);
+    sift_up(heap.size() - 1);
+}
+
+EventQueue::HeapEntry EventQueue::heap_pop() {
+    HeapEntry entry = heap.front();
+
+    heap.front() = heap.back();
+    heap.pop_back();
+    if (!heap.empty()) {
+        sift_down(0);
+    }
+
+    return entry;
+}
+
+void EventQueue::sift_up(size_t index) {
+    HeapEntry entry = heap[index];
+
+    while (index > 0) {
+        size_t parent = (index - 1) / 2;
+        if (!before(entry, heap[parent])) {
+            break;
+        }
+        heap[index] = heap[parent];
+        index = parent;
+    }
+    heap[index] = entry;
+}
+
+void EventQueue::sift_down(size_t index) {
+    HeapEntry entry = heap[index];
+    size_t count = heap.size();
+
+    while (true) {
+        size_t child = 2 * index + 1;
+        if (child >= count) {
+            break;
+        }
+        if (child + 1 < count && before(heap[child + 1], heap[child])) {
+            child++;
+        }
+        if (!before(heap[child], entry)) {
+            break;
+        }
+        heap[index] = heap[child];
+        index = child;
+    }
+    heap[index] = entry;
+}
+
+//==============================================================================
+// Timing wheel
+//==============================================================================
+
+void EventQueue::wheel_insert(const HeapEntry& entry) {
+    unsigned int index = entry.time & (WHEEL_SIZE - 1);
+    std::vector<HeapEntry>& bucket = buckets[index];
+
+    // Events are almost always created in event_num order, so this is nearly always an append.
+    if (bucket.size() == bucket_heads[index] || bucket.back().event_num < entry.event_num) {
+        bucket.push_back(entry);
+    } else {
+        auto position = std::upper_bound(bucket.begin() + bucket_heads[index], bucket.end(), entry,
+            [](const HeapEntry& entry_1, const HeapEntry& entry_2) { return entry_1.event_num < entry_2.event_num; });
+        bucket.insert(position, entry);
+    }
+
+    occupied[index / 64] |= uint64_t(1) << (index % 64);
+    wheel_count++;
+}
+
+void EventQueue::bucket_pop(unsigned int index) {
+    if (++bucket_heads[index] == buckets[index].size()) {
+        buckets[index].clear();
+        bucket_heads[index] = 0;
+        occupied[index / 64] &= ~(uint64_t(1) << (index % 64));
+    }
+    wheel_count--;
+}
+
+void EventQueue::wheel_advance() {
+    unsigned int index = wheel_time & (WHEEL_SIZE - 1);
+
+    if (occupied[index / 64] & (uint64_t(1) << (index % 64))) {
+        return;
+    }
+
+    wheel_time = wheel_next_time();
+
+    while (!heap.empty() && heap.front().time - wheel_time < WHEEL_SIZE) {
+        wheel_insert(heap_pop());
+    }
+}
+
+unsigned int EventQueue::wheel_next_time() const {
+    unsigned int index = wheel_time & (WHEEL_SIZE - 1);
+    bool found = false;
+    unsigned int next_time = 0;
+
+    if (wheel_count > 0) {
+        // Find the first occupied bucket at or after the current one, wrapping around.
+        size_t word = index / 64;
+        uint64_t bits = occupied[word] & (~uint64_t(0) << (index % 64));
+        while (bits == 0) {
+            word = (word + 1) % occupied.size();
+            bits = occupied[word];
+        }
+        unsigned int position = word * 64 + __builtin_ctzll(bits);
+        next_time = wheel_time + ((position - index) & (WHEEL_SIZE - 1));
+        found = true;
+    }
+
+    if (!heap.empty() && (!found || heap.front().time <= next_time)) {
+        next_time = heap.front().time;
+    }
+
+    return next_time;
+}
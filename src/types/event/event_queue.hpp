@@ -0,0 +1,316 @@
+#ifndef EVENT_QUEUE_HPP
+#define EVENT_QUEUE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "types/event/event.hpp"
+
+/*
+    EventQueueBackend:
+        How the event queue orders its pending events.
+
+        HEAP_QUEUE:
+            A binary heap. O(log n) pushes and pops regardless of the event times.
+
+        WHEEL_QUEUE:
+            A timing wheel with one bucket per tick, backed by the heap for events that are
+            further in the future than the wheel covers. O(1) amortized pushes and pops when
+            event times advance mostly monotonically in small steps, which is what the
+            simulation does.
+*/
+enum EventQueueBackend {
+    HEAP_QUEUE,
+    WHEEL_QUEUE
+};
+
+/*
+    EventHandle:
+        Refers to an event that has been pushed onto an EventQueue, so that it can be cancelled.
+        A handle stays safe to use after its event has been popped or cancelled; it just no
+        longer refers to a pending event. A default constructed handle never does.
+*/
+struct EventHandle {
+    unsigned int slot = 0;
+    unsigned int generation = 0;
+};
+
+/*
+    EventQueue:
+        The simulation's priority queue of pending events.
+
+        Events are stored by value in a slab of slots that get recycled once an event has been
+        popped, so pushing an event does not allocate once the slab has grown to the peak number
+        of pending events. The ordering structures only hold small (time, event_num, slot) entries,
+        so they never move the events themselves.
+
+        Events are ordered by time, and events with the same time are ordered by their event_num.
+        Both backends produce exactly the same order.
+
+        Cancelling an event is O(1): its slot is freed right away and given a new generation,
+        which leaves the entry in the ordering structures as a tombstone that is skipped when
+        it reaches the front. Once tombstones make up more than half of the entries (and there
+        are at least COMPACT_THRESHOLD of them), they are swept out all at once, so long runs
+        with many cancellations do not bloat the heap.
+*/
+
+class EventQueue {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        EventQueue(backend):
+            Creates an empty event queue ordered by the given backend.
+    */
+    EventQueue(EventQueueBackend backend = HEAP_QUEUE);
+
+    /*
+        push(event):
+            Moves the event into a free slot and adds it to the queue, returning a handle to it.
+            With the wheel backend, the event must not be earlier than the last event returned
+            by top() or pop().
+    */
+    EventHandle push(Event&& event);
+
+    /*
+        cancel(handle):
+            Removes the event from the queue if it is still pending. Returns true if it was.
+    */
+    bool cancel(EventHandle handle);
+
+    /*
+        pending(handle):
+            Returns true if the event has been neither popped nor cancelled.
+    */
+    bool pending(EventHandle handle) const {
+        return handle.generation != 0 && handle.slot < slots.size() && slot_generations[handle.slot] == handle.generation;
+    }
+
+    /*
+        pending_events():
+            Returns a handle to every pending event, in no particular order. Used to save checkpoints.
+    */
+    std::vector<EventHandle> pending_events() const;
+
+    /*
+        event(handle):
+            Returns the pending event that the handle refers to.
+    */
+    const Event& event(EventHandle handle) const { return slots[handle.slot]; }
+
+    /*
+        top():
+            Returns the next event to occur. The queue must not be empty.
+    */
+    const Event& top();
+
+    /*
+        pop():
+            Removes the next event to occur from the queue and returns it. The
+            queue must not be empty.
+    */
+    Event pop();
+
+    /*
+        pop_batch(batch):
+            Removes every event with the same time as the next event to occur, and appends them
+            to batch in the order pop() would have returned them. Returns how many there were.
+            With the wheel backend they are taken from their bucket all at once. The queue must
+            not be empty.
+    */
+    size_t pop_batch(std::vector<Event>& batch);
+
+    /*
+        next_time():
+            Returns the time of the next event to occur without moving the queue forward, so
+            events as early as the last one popped can still be pushed afterwards. The queue
+            must not be empty.
+    */
+    unsigned int next_time();
+
+    /*
+        empty():
+            Returns true if there are no pending events.
+    */
+    bool empty() const { return size() == 0; }
+
+    /*
+        size():
+            Returns the number of pending events.
+    */
+    size_t size() const { return heap.size() + wheel_count - tombstones; }
+
+private:
+
+    /*
+        HeapEntry:
+            The ordering key of an event, along with the slot that holds it.
+    */
+    struct HeapEntry {
+        unsigned int time;
+        unsigned int event_num;
+        unsigned int slot;
+        unsigned int generation;
+    };
+
+    /*
+        WHEEL_SIZE:
+            The number of ticks the wheel covers. Must be a multiple of 64 and a power of two.
+    */
+    static const unsigned int WHEEL_SIZE = 1024;
+
+    /*
+        COMPACT_THRESHOLD:
+            The fewest tombstones worth sweeping out of the ordering structures.
+    */
+    static const size_t COMPACT_THRESHOLD = 1024;
+
+    EventQueueBackend backend;
+
+    /*
+        slots:
+            Storage for the events. A slot is only valid while it is referenced by an entry.
+    */
+    std::vector<Event> slots;
+
+    /*
+        free_slots:
+            Indices of slots whose events have been popped and can be reused.
+    */
+    std::vector<unsigned int> free_slots;
+
+    /*
+        slot_generations:
+            The generation of each slot, which changes whenever the slot's event is popped or
+            cancelled. An entry or handle only refers to the slot's event if its generation
+            matches. Generations start at 1.
+    */
+    std::vector<unsigned int> slot_generations;
+
+    /*
+        tombstones:
+            The number of entries in the heap and on the wheel whose events were cancelled.
+    */
+    size_t tombstones = 0;
+
+    /*
+        heap:
+            A binary min-heap of entries, ordered by before(). With the wheel backend, this
+            only holds the events that are too far in the future to fit on the wheel.
+    */
+    std::vector<HeapEntry> heap;
+
+    /*
+        wheel_time:
+            The tick the wheel is currently at. Every entry on the wheel has a time in
+            [wheel_time, wheel_time + WHEEL_SIZE), so each bucket only holds a single time.
+    */
+    unsigned int wheel_time = 0;
+
+    /*
+        wheel_count:
+            The number of entries on the wheel.
+    */
+    size_t wheel_count = 0;
+
+    /*
+        buckets / bucket_heads:
+            The entries for each tick of the wheel, sorted by event_num. Entries before
+            bucket_heads[i] have already been popped.
+    */
+    std::vector<std::vector<HeapEntry>> buckets;
+    std::vector<size_t> bucket_heads;
+
+    /*
+        occupied:
+            A bitmap with a bit set for every non-empty bucket.
+    */
+    std::vector<uint64_t> occupied;
+
+    /*
+        before(entry_1, entry_2):
+            Returns true if entry_1 should be handled before entry_2. Fundamentally we order events
+            by their time, but if two events have the same time, the event that was created first
+            (the one with the lower event_num) goes first.
+    */
+    static bool before(const HeapEntry& entry_1, const HeapEntry& entry_2) {
+        if (entry_1.time == entry_2.time) {
+            return entry_1.event_num < entry_2.event_num;
+        }
+        return entry_1.time < entry_2.time;
+    }
+
+    bool live(const HeapEntry& entry) const { return slot_generations[entry.slot] == entry.generation; }
+
+    /*
+        release(slot):
+            Gives the slot a new generation and makes it free for reuse.
+    */
+    void release(unsigned int slot);
+
+    /*
+        take(entry, batch):
+            Moves a removed entry's event onto the end of batch and frees its slot, or forgets
+            the entry if it was a tombstone.
+    */
+    void take(const HeapEntry& entry, std::vector<Event>& batch);
+
+    /*
+        drop_cancelled():
+            Removes tombstones from the front of the queue, so that the next entry (if there is
+            one) is live. Does not move the wheel forward.
+    */
+    void drop_cancelled();
+
+    /*
+        compact():
+            Sweeps every tombstone out of the heap and the wheel's buckets.
+    */
+    void compact();
+
+    /*
+        bucket_pop(index):
+            Removes the first entry of the wheel bucket with the given index.
+    */
+    void bucket_pop(unsigned int index);
+
+    void heap_push(const HeapEntry& entry);
+
+    HeapEntry heap_pop();
+
+    void sift_up(size_t index);
+
+    void sift_down(size_t index);
+
+    /*
+        wheel_insert(entry):
+            Puts an entry that fits within the wheel's window into its bucket.
+    */
+    void wheel_insert(const HeapEntry& entry);
+
+    /*
+        wheel_advance():
+            Moves wheel_time forward to the earliest pending event, pulling any heap entries
+            that now fit within the window onto the wheel. Afterwards the bucket at wheel_time
+            holds the next event.
+    */
+    void wheel_advance();
+
+    /*
+        wheel_next_time():
+            Returns the time of the earliest pending event, on the wheel or in the heap.
+    */
+    unsigned int wheel_next_time() const;
+
+    /*
+        next_entry():
+            Returns the entry of the next event to occur, without removing it.
+    */
+    const HeapEntry& next_entry();
+};
+
+#endif
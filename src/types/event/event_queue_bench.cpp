@@ -0,0 +1,66 @@
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "types/event/event_queue.hpp"
+#include "utilities/benchmark/benchmark.hpp"
+
+/*
+    Measures the event queue under the pattern preemption puts it through: a steady number of
+    pending burst end events, where every step pops the earliest one and schedules a new one,
+    and some fraction of steps also cancel a pending event and schedule a preemption instead.
+*/
+
+namespace {
+
+const int PENDING = 1000;
+const int OPERATIONS = 1000000;
+
+double time_events(EventQueueBackend backend, int cancel_percent) {
+    int64_t total = 0;
+    double seconds = time_best_of(5, [&] {
+        EventQueue queue(backend);
+        std::vector<EventHandle> handles(PENDING);
+        unsigned int event_num = 0;
+        uint32_t state = 12345;
+        auto next_random = [&] {
+            state = state * 1103515245 + 12345;
+            return state >> 8;
+        };
+
+        for (int cpu = 0; cpu < PENDING; ++cpu) {
+            handles[cpu] = queue.push(Event(CPU_BURST_COMPLETED, next_random() % 2000, event_num++, nullptr, cpu));
+        }
+        for (int operation = 0; operation < OPERATIONS; ++operation) {
+            Event event = queue.pop();
+            total += event.time;
+            handles[event.cpu] = queue.push(Event(CPU_BURST_COMPLETED, event.time + 1 + next_random() % 2000, event_num++, nullptr, event.cpu));
+
+            if (int(next_random() % 100) < cancel_percent) {
+                int cpu = next_random() % PENDING;
+                if (queue.cancel(handles[cpu])) {
+                    handles[cpu] = queue.push(Event(THREAD_PREEMPTED, event.time + 1, event_num++, nullptr, cpu));
+                }
+            }
+        }
+        while (!queue.empty()) {
+            queue.pop();
+        }
+    });
+
+    // Using the result keeps the loop from being optimized away
+    if (total <= 0) {
+        throw std::logic_error("The queue returned no events.");
+    }
+
+    return seconds;
+}
+
+}
+
+BENCHMARK(event_queue_cancel) {
+    report("heap, no cancels", time_events(HEAP_QUEUE, 0), OPERATIONS, "events");
+    report("heap, 50% cancels", time_events(HEAP_QUEUE, 50), OPERATIONS, "events");
+    report("wheel, no cancels", time_events(WHEEL_QUEUE, 0), OPERATIONS, "events");
+    report("wheel, 50% cancels", time_events(WHEEL_QUEUE, 50), OPERATIONS, "events");
+}
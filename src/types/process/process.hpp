@@ -34,6 +34,13 @@ public:
     */
     ProcessPriority priority;
 
+    /*
+        tickets:
+            The tickets given to each of the process's threads, or -1 to use the default for
+            its priority. Taken from the optional last column of the process's line.
+    */
+    int tickets = -1;
+
     /*
         threads:
             A vector of the process's threads.
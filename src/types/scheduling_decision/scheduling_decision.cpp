@@ -0,0 +1,32 @@
+#include "types/scheduling_decision/scheduling_decision.hpp"
+
+#include "utilities/fmt/format.h"
+
+namespace fmt {
+
+template <>
+struct formatter<ExplanationArg> : formatter<string_view> {
+    template <class FormatContext>
+    auto format(const ExplanationArg& arg, FormatContext& context) {
+        if (arg.text) {
+            return formatter<string_view>::format(arg.text, context);
+        }
+        return format_to(context.out(), "{}", arg.value);
+    }
+};
+
+}
+
+std::string SchedulingDecision::explanation() const {
+    const auto& args = explanation_args;
+
+    // Arguments the format string does not use are ignored
+    std::string message = fmt::format(explanation_format, args[0], args[1], args[2], args[3],
+                                      args[4], args[5], args[6], args[7]);
+
+    if (stolen_from != -1) {
+        message += fmt::format(" Stolen from CPU {}.", stolen_from);
+    }
+
+    return message;
+}
@@ -1,14 +1,37 @@
 #ifndef SCHEDULING_DECISION_HPP
 #define SCHEDULING_DECISION_HPP
 
+#include <array>
 #include <memory>
+#include <string>
 
 #include "types/thread/thread.hpp"
 
+/*
+    ExplanationArg:
+        One value to fill into a scheduling decision's explanation: an integer, or a
+        string literal if text is set.
+*/
+
+struct ExplanationArg {
+    const char* text = nullptr;
+
+    int value = 0;
+
+    ExplanationArg() {}
+
+    ExplanationArg(int value) : value(value) {}
+
+    ExplanationArg(const char* text) : text(text) {}
+};
+
 /*
     SchedulingDecision:
         A class for a scheduling decision. This is what your
         algorithm should return.
+
+        Decisions are returned by value, and their explanations are only formatted when
+        they are printed, so making a decision allocates nothing unless verbose output is on.
 */
 
 class SchedulingDecision {
@@ -23,13 +46,23 @@ public:
             A thread. The next thread to run,
     */
     std::shared_ptr<Thread> thread = nullptr;
-    
+
+    /*
+        explanation_format / explanation_args:
+            Why the thread was chosen, as an fmt format string and the values to fill in.
+            The format string must be a string literal (or otherwise outlive the decision).
+            Set them with explain(), and see the Scheduler class for an example.
+    */
+    const char* explanation_format = "No threads available for scheduling.";
+
+    std::array<ExplanationArg, 8> explanation_args;
+
     /*
-        explanation:
-            A string containing an explanation of the scheduling decision. See
-            the Scheduler class for an example of what this should be.
+        stolen_from:
+            The CPU whose run queue the thread was stolen from, or -1 if it was not stolen.
+            Mentioned at the end of the explanation.
     */
-    std::string explanation;
+    int stolen_from = -1;
 
     /*
         time_slice:
@@ -37,7 +70,29 @@ public:
             should not be preempted.
     */
     int time_slice = -1;
-    
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        explain(format, args...):
+            Sets the explanation to the format string filled in with up to 8 integers
+            or string literals, like:
+                decision.explain("Selected from {} threads. Will run for at most {} ticks.", count, slice);
+    */
+    template <class... Args>
+    void explain(const char* format, Args... args) {
+        static_assert(sizeof...(Args) <= 8, "explanations take at most 8 values");
+        explanation_format = format;
+        explanation_args = {{ExplanationArg(args)...}};
+    }
+
+    /*
+        explanation():
+            Formats the explanation.
+    */
+    std::string explanation() const;
 };
 
 #endif
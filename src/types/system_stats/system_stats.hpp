@@ -1,6 +1,9 @@
 #ifndef SYSTEM_STATS_HPP
 #define SYSTEM_STATS_HPP
 
+#include <cstddef>
+#include <vector>
+
 /*
     SystemStats:
         A simple class for encapsulating the statistics that
@@ -28,7 +31,8 @@ public:
 
     /*
         total_idle_time:
-            The amount of time that the processor has been idle.
+            The amount of time that the processor has been idle. Added up by the simulation
+            as each idle interval ends, like cpu_idle_times.
     */
     size_t total_idle_time = 0;
 
@@ -73,6 +77,124 @@ public:
             The average turnaround time for threads of different priorities.
     */
     double avg_thread_turnaround_times[4] = {0.0, 0.0, 0.0, 0.0};
+
+    /*
+        cpu_service_times / cpu_dispatch_times / cpu_idle_times:
+            The service, dispatch and idle time of each simulated CPU. The totals above are
+            summed over all CPUs.
+    */
+    std::vector<size_t> cpu_service_times;
+    std::vector<size_t> cpu_dispatch_times;
+    std::vector<size_t> cpu_idle_times;
+
+    /*
+        idle_intervals:
+            A histogram of how long the CPUs sat idle each time: idle_intervals[i] is the number
+            of idle intervals with a length from 2^i up to 2^(i + 1) - 1 ticks. Intervals where a
+            CPU was woken at the same time it went idle are not counted.
+    */
+    std::vector<size_t> idle_intervals;
+
+    /*
+        cpu_utilizations:
+            The percentage of time each simulated CPU did work.
+    */
+    std::vector<double> cpu_utilizations;
+
+    /*
+        migrations:
+            The number of times a thread was dispatched on a different CPU than the one it last ran on.
+    */
+    size_t migrations = 0;
+
+    /*
+        steals:
+            The number of threads an idle CPU took from another CPU's run queue.
+    */
+    size_t steals = 0;
+
+    /*
+        rebalance_moves:
+            The number of threads moved between run queues by periodic rebalancing.
+    */
+    size_t rebalance_moves = 0;
+
+    /*
+        dispatches_coalesced:
+            With the -d, --coalesce_dispatches flag, the number of DISPATCHER_INVOKED events
+            that were never added because they could only have found the ready queue empty.
+    */
+    size_t dispatches_coalesced = 0;
+
+    /*
+        deadline_misses:
+            The number of threads with a deadline that finished after it.
+    */
+    size_t deadline_misses = 0;
+
+    /*
+        deadline_threads / total_tardiness / max_tardiness:
+            The number of threads with a deadline, and the sum and the largest of how late they
+            finished (0 if they were on time).
+    */
+    size_t deadline_threads = 0;
+    double total_tardiness = 0.0;
+    int max_tardiness = 0;
+
+    /*
+        tardiness_histogram:
+            How late the threads with a deadline finished, kept in a fixed number of buckets so
+            that it takes the same memory however many threads there are. Each tardiness below
+            2 * TARDINESS_SUB_BUCKETS has a bucket of its own. Above that, each range from 2^i up
+            to 2^(i + 1) - 1 is split into TARDINESS_SUB_BUCKETS equal buckets, so the values in a
+            bucket are within 1/16 of each other. See tardiness_bucket().
+    */
+    static const int TARDINESS_SUB_BUCKET_BITS = 4;
+    static const int TARDINESS_SUB_BUCKETS = 1 << TARDINESS_SUB_BUCKET_BITS;
+    static const int TARDINESS_BUCKETS = (32 - TARDINESS_SUB_BUCKET_BITS) * TARDINESS_SUB_BUCKETS;
+    size_t tardiness_histogram[TARDINESS_BUCKETS] = {};
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        tardiness_bucket(tardiness):
+            The bucket of tardiness_histogram that a (non-negative) tardiness is counted in.
+    */
+    static int tardiness_bucket(int tardiness) {
+        if (tardiness < 2 * TARDINESS_SUB_BUCKETS) {
+            return tardiness;
+        }
+        // The highest set bit picks the power of two, and the bits below it the sub-bucket
+        int exponent = 31 - __builtin_clz(tardiness);
+        int shift = exponent - TARDINESS_SUB_BUCKET_BITS;
+        return shift * TARDINESS_SUB_BUCKETS + (tardiness >> shift);
+    }
+
+    /*
+        tardiness_bucket_max(bucket):
+            The largest tardiness counted in the given bucket of tardiness_histogram.
+    */
+    static int tardiness_bucket_max(int bucket) {
+        if (bucket < 2 * TARDINESS_SUB_BUCKETS) {
+            return bucket;
+        }
+        int shift = bucket / TARDINESS_SUB_BUCKETS - 1;
+        int low = (bucket % TARDINESS_SUB_BUCKETS + TARDINESS_SUB_BUCKETS) << shift;
+        return low + ((1 << shift) - 1);
+    }
+
+    /*
+        contended_dispatches / class_wins[4] / class_entitlements[4]:
+            Filled in by the proportional-share schedulers (see ShareTracker). The number of
+            dispatches made while more than one thread was ready, how many of them went to
+            each priority, and how many each priority was entitled to by its share of the
+            ready threads' tickets.
+    */
+    size_t contended_dispatches = 0;
+    size_t class_wins[4] = {0, 0, 0, 0};
+    double class_entitlements[4] = {0.0, 0.0, 0.0, 0.0};
 };
 
 #endif
@@ -1,6 +1,8 @@
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <stdexcept>
+#include <utility>
 #include "types/thread/thread.hpp"
 
 void Thread::set_ready(int time) {
@@ -71,6 +73,14 @@ int Thread::turnaround_time() const {
     return end_time - arrival_time;
 }
 
+int Thread::deadline() const {
+    return relative_deadline == -1 ? -1 : arrival_time + relative_deadline;
+}
+
+int Thread::tardiness() const {
+    return std::max(0, end_time - deadline());
+}
+
 void Thread::set_state(ThreadState state, int time) {
     switch (state)
     {
@@ -91,23 +101,53 @@ void Thread::set_state(ThreadState state, int time) {
     }
 }
 
-std::shared_ptr<Burst> Thread::get_next_burst(BurstType type) {
-    if (bursts.empty()) return nullptr;
+void Thread::set_bursts(std::shared_ptr<const int32_t> bursts, uint32_t num_bursts) {
+    this->bursts = std::move(bursts);
+    this->num_bursts = num_bursts;
+    this->next_burst = 0;
+    this->remaining_time = (num_bursts > 0) ? this->bursts.get()[0] : 0;
+}
+
+int Thread::get_next_burst(BurstType type) const {
+    if (next_burst == num_bursts) return 0;
 
-    auto burst = bursts.front();
-    if (burst->burst_type == type) {
-        return burst;   
+    if (next_burst_type() == type) {
+        return remaining_time;
     } else {
         throw std::logic_error("Current burst is not of expected type.");
     }
 }
 
-std::shared_ptr<Burst> Thread::pop_next_burst(BurstType type) {
-    auto burst = bursts.front();
-    if (burst->burst_type == type) {
-        bursts.pop();  
-    } else {
+void Thread::pop_next_burst(BurstType type) {
+    if (next_burst == num_bursts || next_burst_type() != type) {
         throw std::logic_error("Current burst is not of expected type.");
     }
-    return nullptr;
+
+    if (type == CPU) {
+        burst_estimate = (burst_estimate + bursts.get()[next_burst]) / 2;
+    }
+
+    next_burst++;
+    remaining_time = (next_burst < num_bursts) ? bursts.get()[next_burst] : 0;
+}
+
+int Thread::peek_next_burst(BurstType type) const {
+    if (next_burst == num_bursts) return 0;
+
+    if (next_burst_type() == type) {
+        return remaining_time;
+    }
+
+    // The burst after this one has the other type, and is whole
+    return (next_burst + 1 < num_bursts) ? bursts.get()[next_burst + 1] : 0;
+}
+
+int Thread::estimated_remaining_time() const {
+    // Only a CPU burst that is next can have partly run
+    int ran = (next_burst < num_bursts && next_burst_type() == CPU) ? bursts.get()[next_burst] - remaining_time : 0;
+    return std::max(1, burst_estimate - ran);
+}
+
+void Thread::update_next_burst(int delta_t) {
+    remaining_time = (remaining_time - delta_t >= 0) ? (remaining_time - delta_t) : 0;
 }
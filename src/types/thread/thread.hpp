@@ -1,12 +1,11 @@
 #ifndef THREAD_HPP
 #define THREAD_HPP
 
+#include <cstdint>
 #include <iostream>
 #include <memory>
 #include <vector>
-#include <queue>
 
-#include "types/burst/burst.hpp"
 #include "types/enums.hpp"
 
 /*
@@ -49,6 +48,28 @@ public:
     */
     int arrival_time = -1;
 
+    /*
+        relative_deadline:
+            How long after its arrival the thread should be finished by, or -1 if it has no
+            deadline. Taken from the optional deadline column of the input file.
+    */
+    int relative_deadline = -1;
+
+    /*
+        period:
+            How often the thread's work recurs, or -1 if it is not periodic. Taken from the
+            optional period column of the input file, and used by rate-monotonic scheduling.
+    */
+    int period = -1;
+
+    /*
+        tickets:
+            The thread's share of the CPU under the proportional-share schedulers (lottery and
+            stride), taken from its process's optional tickets column, or -1 if the file did not
+            give one. Use ticket_count() to get the tickets the thread actually has.
+    */
+    int tickets = -1;
+
     /*
         start_time:
             The time the CPU was first able to execute this thread. Should be set when
@@ -102,10 +123,49 @@ public:
 
     /*
         bursts:
-            A queue of bursts. Should contain the CPU and IO bursts in the correct order as
-            specified in the simulation file.
+            The lengths of the thread's bursts, in the order specified in the simulation file.
+            Bursts alternate between CPU and IO, starting and ending with a CPU burst, so
+            their types are implied by their positions.
+
+            The lengths are never changed. They point into a burst table shared by the whole
+            workload (a vector filled in by the parser, or a mapped binary simulation file),
+            which this pointer keeps alive, so copying a thread does not copy its bursts.
+    */
+    std::shared_ptr<const int32_t> bursts;
+
+    /*
+        num_bursts:
+            How many bursts the thread has in total.
     */
-    std::queue<std::shared_ptr<Burst>> bursts;
+    uint32_t num_bursts = 0;
+
+    /*
+        next_burst:
+            The index of the thread's next burst. Bursts before it are done.
+    */
+    uint32_t next_burst = 0;
+
+    /*
+        remaining_time:
+            How much of the next burst is left, which is less than its length once the
+            burst has been preempted.
+    */
+    int remaining_time = 0;
+
+    /*
+        INITIAL_BURST_ESTIMATE:
+            What burst_estimate starts at, before the thread has finished any CPU burst.
+    */
+    static constexpr int INITIAL_BURST_ESTIMATE = 10;
+
+    /*
+        burst_estimate:
+            A prediction of the length of the thread's next CPU burst, for schedulers that
+            should not look at the lengths in the simulation file. pop_next_burst updates it
+            by exponential averaging with a weight of 1/2: the new estimate is the mean of
+            the old estimate and the length of the CPU burst that just finished.
+    */
+    int burst_estimate = INITIAL_BURST_ESTIMATE;
 
 
     // TODO: Add any other variables you may find useful to have, especially for the MLFQ and CFS algorithms!
@@ -144,20 +204,80 @@ public:
     */
     int turnaround_time() const;
 
+    /*
+        DEFAULT_TICKETS:
+            The tickets a thread has if its process did not give any, by process priority.
+    */
+    static constexpr int DEFAULT_TICKETS[4] = {800, 400, 200, 100};
+
+    /*
+        ticket_count():
+            The thread's tickets, or the default for its priority.
+    */
+    int ticket_count() const { return tickets != -1 ? tickets : DEFAULT_TICKETS[priority]; }
+
+    /*
+        deadline():
+            The time the thread should be finished by, or -1 if it has no deadline.
+    */
+    int deadline() const;
+
+    /*
+        tardiness():
+            How long after its deadline the thread finished, or 0 if it finished in time.
+            Only meaningful once the thread has finished and if it has a deadline.
+    */
+    int tardiness() const;
+
+    /*
+        set_bursts(bursts, num_bursts):
+            Gives the thread its bursts, starting from the first one.
+    */
+    void set_bursts(std::shared_ptr<const int32_t> bursts, uint32_t num_bursts);
+
     /*
         get_next_burst(type):
-            Get the next burst. We should ensure that the next burst in the queue
-            is of the appropriate type.
+            Get the remaining length of the next burst, or 0 if there are no bursts left.
+            We should ensure that the next burst is of the appropriate type.
     */
-    std::shared_ptr<Burst> get_next_burst(BurstType type);
+    int get_next_burst(BurstType type) const;
 
 
     /*
         pop_next_burst(type):
-            Pop the next burst. We should ensure that the next burst in the queue
+            Pop the next burst. We should ensure that the next burst
             is of the appropriate type.
     */
-    std::shared_ptr<Burst> pop_next_burst(BurstType type);
+    void pop_next_burst(BurstType type);
+
+    /*
+        update_next_burst(delta_t):
+            Update the next burst's remaining length after it has run for delta_t,
+            e.g. when it has been preempted.
+    */
+    void update_next_burst(int delta_t);
+
+    /*
+        peek_next_burst(type):
+            Get the remaining length of the next burst of the given type without popping
+            anything, or 0 if there is none. Unlike get_next_burst, this looks past a
+            burst of the other type, so a blocked thread can be asked for its next CPU
+            burst. Takes constant time, since bursts alternate.
+    */
+    int peek_next_burst(BurstType type) const;
+
+    /*
+        estimated_remaining_time():
+            The predicted length of what is left of the next CPU burst: burst_estimate less
+            however much of the burst has already run, but at least 1.
+    */
+    int estimated_remaining_time() const;
+
+    /*
+        next_burst_type():
+            The type of the next burst, which alternates starting with a CPU burst.
+    */
+    BurstType next_burst_type() const { return (next_burst % 2 == 0) ? CPU : IO; }
 
 
     // My stuff
@@ -168,6 +288,26 @@ public:
 
     int prev_service_time = 0;
 
+    /*
+        stride_pass:
+            The thread's pass value under stride scheduling, which grows by its stride for
+            every tick it runs.
+    */
+    int64_t stride_pass = 0;
+
+    /*
+        last_cpu:
+            The CPU this thread was last dispatched on, or -1 if it has not run yet.
+    */
+    int last_cpu = -1;
+
+    /*
+        run_queue:
+            The CPU whose run queue holds this thread when the scheduler keeps one run
+            queue per CPU, or -1 otherwise.
+    */
+    int run_queue = -1;
+
 };
 
 #endif
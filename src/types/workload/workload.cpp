@@ -0,0 +1,39 @@
+#include "types/workload/workload.hpp"
+
+#include <stdexcept>
+
+Workload Workload::clone() const {
+    Workload copy;
+    copy.thread_switch_overhead = thread_switch_overhead;
+    copy.process_switch_overhead = process_switch_overhead;
+
+    for (const auto& process : processes) {
+        auto process_copy = std::make_shared<Process>(process->process_id, process->priority);
+        process_copy->tickets = process->tickets;
+
+        for (const auto& thread : process->threads) {
+            process_copy->threads.push_back(std::make_shared<Thread>(*thread));
+        }
+
+        copy.processes.push_back(process_copy);
+    }
+
+    return copy;
+}
+
+void Workload::attach_bursts(std::vector<int32_t>&& burst_table) {
+    auto table = std::make_shared<const std::vector<int32_t>>(std::move(burst_table));
+    size_t first_burst = 0;
+
+    for (const auto& process : processes) {
+        for (const auto& thread : process->threads) {
+            if (thread->num_bursts > table->size() - first_burst) {
+                throw std::logic_error("The burst table is missing bursts.");
+            }
+
+            // Shares ownership of the table, but points at the thread's first burst
+            thread->set_bursts(std::shared_ptr<const int32_t>(table, table->data() + first_burst), thread->num_bursts);
+            first_burst += thread->num_bursts;
+        }
+    }
+}
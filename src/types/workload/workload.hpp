@@ -0,0 +1,67 @@
+#ifndef WORKLOAD_HPP
+#define WORKLOAD_HPP
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "types/process/process.hpp"
+
+/*
+    Workload:
+        Everything that is read in from a simulation file: the switch overheads and the
+        processes, along with their threads and bursts.
+
+        Running a simulation changes the threads (their states, times and remaining bursts),
+        so a workload that should be simulated more than once has to be cloned for each run.
+        The burst lengths themselves live in one contiguous table that the threads point
+        into and never change, so clones share it.
+*/
+
+class Workload {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        thread_switch_overhead:
+            An integer for the thread switch overhead, as specified in the simulation file.
+    */
+    int thread_switch_overhead = 0;
+
+    /*
+        process_switch_overhead:
+            An integer for the process switch overhead, as specified in the simulation file.
+    */
+    int process_switch_overhead = 0;
+
+    /*
+        processes:
+            The processes, in the order they appear in the simulation file. This order
+            decides how threads that arrive at the same time are ordered.
+    */
+    std::vector<std::shared_ptr<Process>> processes;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        clone():
+            Returns a deep copy of this workload that shares no processes or threads with
+            it. The copy shares the (read-only) burst table.
+    */
+    Workload clone() const;
+
+    /*
+        attach_bursts(burst_table):
+            Takes ownership of a burst table holding every thread's bursts back to back, in
+            the order of processes and their threads, and points each thread at its part
+            of it. Each thread's num_bursts must already be set.
+    */
+    void attach_bursts(std::vector<int32_t>&& burst_table);
+};
+
+#endif
@@ -0,0 +1,52 @@
+#include "utilities/benchmark/benchmark.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <random>
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+std::map<std::string, BenchmarkFunction>& benchmarks() {
+    static std::map<std::string, BenchmarkFunction> registered;
+    return registered;
+}
+
+double time_best_of(int repetitions, const std::function<void()>& body) {
+    double best = 0.0;
+    for (int i = 0; i < repetitions; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        best = (i == 0) ? elapsed.count() : std::min(best, elapsed.count());
+    }
+    return best;
+}
+
+void report(const std::string& label, double seconds, double items, const std::string& unit) {
+    std::cout << fmt::format("    {:<40} {:>10.3f} ms {:>14.0f} {}/s\n", label, seconds * 1000, items / seconds, unit);
+}
+
+size_t write_random_trace(const std::string& filename, int num_processes, int num_threads, int num_bursts) {
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> burst_length(1, 500);
+    std::uniform_int_distribution<int> arrival(0, 100000);
+    std::uniform_int_distribution<int> priority(0, 3);
+
+    std::ofstream output(filename);
+    output << num_processes << " 3 7\n\n";
+    for (int proc = 0; proc < num_processes; ++proc) {
+        output << proc << " " << priority(random) << " " << num_threads << "\n";
+        for (int thread = 0; thread < num_threads; ++thread) {
+            output << arrival(random) << " " << num_bursts << "\n";
+            for (int burst = 0; burst < num_bursts - 1; ++burst) {
+                output << burst_length(random) << " " << burst_length(random) << "\n";
+            }
+            output << burst_length(random) << "\n\n";
+        }
+    }
+
+    return output.tellp();
+}
@@ -0,0 +1,67 @@
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+
+/*
+    Benchmarks:
+        Micro-benchmarks live in *_bench.cpp files next to the code they measure, and are
+        built into a separate, optimized cpu-sim-bench program with "make bench". Each one
+        is defined with the BENCHMARK macro:
+
+            BENCHMARK(event_queue_push_pop) {
+                double seconds = time_best_of(5, [] { ... });
+                report("heap", seconds, 1000000, "events");
+            }
+
+        "./cpu-sim-bench" runs all of them, and "./cpu-sim-bench name..." runs the ones
+        whose names start with any of the given names.
+*/
+
+using BenchmarkFunction = void (*)();
+
+/*
+    benchmarks():
+        Every registered benchmark, by name.
+*/
+std::map<std::string, BenchmarkFunction>& benchmarks();
+
+/*
+    BenchmarkRegistration:
+        Registers a benchmark when it is constructed. Used by the BENCHMARK macro.
+*/
+class BenchmarkRegistration {
+public:
+    BenchmarkRegistration(const char* name, BenchmarkFunction function) {
+        benchmarks()[name] = function;
+    }
+};
+
+#define BENCHMARK(name) \
+    static void name(); \
+    static BenchmarkRegistration name##_registration(#name, name); \
+    static void name()
+
+/*
+    time_best_of(repetitions, body):
+        Runs body the given number of times and returns the fastest run in seconds.
+*/
+double time_best_of(int repetitions, const std::function<void()>& body);
+
+/*
+    report(label, seconds, items, unit):
+        Prints a result line with the time taken and how many items per second that is.
+*/
+void report(const std::string& label, double seconds, double items, const std::string& unit);
+
+/*
+    write_random_trace(filename, num_processes, num_threads, num_bursts):
+        Writes a random (but always the same) simulation file with the given number of processes,
+        threads per process and CPU bursts per thread. Returns its size in bytes.
+*/
+size_t write_random_trace(const std::string& filename, int num_processes, int num_threads, int num_bursts);
+
+#endif
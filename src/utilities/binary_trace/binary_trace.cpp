@@ -0,0 +1,246 @@
+#include "utilities/binary_trace/binary_trace.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "simulation/simulation.hpp"
+#include "types/enums.hpp"
+
+namespace {
+
+uint64_t align_8(uint64_t offset) {
+    return (offset + 7) & ~uint64_t(7);
+}
+
+}
+
+BinaryTrace::BinaryTrace(std::shared_ptr<const MappedFile> file, const std::string& source) : file(file), source(source) {
+    const char* data = file->data();
+    size_t size = file->size();
+
+    if (!matches(data, size) || size < sizeof(BinaryTraceHeader)) {
+        fail("not a binary simulation file");
+    }
+
+    file_header = reinterpret_cast<const BinaryTraceHeader*>(data);
+    const BinaryTraceHeader& header = *file_header;
+
+    if (header.version != BINARY_TRACE_VERSION) {
+        fail("unsupported binary simulation file version " + std::to_string(header.version) +
+             " (expected " + std::to_string(BINARY_TRACE_VERSION) + ")");
+    }
+    if (header.thread_switch_overhead < 0 || header.process_switch_overhead < 0) {
+        fail("switch overheads cannot be negative");
+    }
+
+    // The table sizes come from 32 bit counts, so none of these can overflow.
+    uint64_t processes_offset = sizeof(BinaryTraceHeader);
+    uint64_t threads_offset = processes_offset + uint64_t(header.num_processes) * sizeof(BinaryTraceProcess);
+    uint64_t arrival_offset = threads_offset + uint64_t(header.num_threads) * sizeof(BinaryTraceThread);
+    uint64_t bursts_offset = align_8(arrival_offset + uint64_t(header.num_threads) * sizeof(uint32_t));
+
+    if (bursts_offset > size) {
+        fail("the process and thread tables do not fit in the file");
+    }
+    if (header.num_bursts != (size - bursts_offset) / sizeof(int32_t) ||
+        (size - bursts_offset) % sizeof(int32_t) != 0) {
+        fail("the burst table does not match the size of the file");
+    }
+
+    processes = reinterpret_cast<const BinaryTraceProcess*>(data + processes_offset);
+    threads = reinterpret_cast<const BinaryTraceThread*>(data + threads_offset);
+    arrival_order = reinterpret_cast<const uint32_t*>(data + arrival_offset);
+    burst_table = reinterpret_cast<const int32_t*>(data + bursts_offset);
+
+    uint32_t next_thread = 0;
+    for (uint32_t index = 0; index < header.num_processes; ++index) {
+        const BinaryTraceProcess& process = processes[index];
+        if (process.priority < SYSTEM || process.priority > BATCH) {
+            fail("process " + std::to_string(index) + ": process priorities must be between 0 and 3");
+        }
+        if (process.tickets != -1 && process.tickets <= 0) {
+            fail("process " + std::to_string(index) + ": tickets must be positive");
+        }
+        if (process.first_thread != next_thread || process.num_threads > header.num_threads - next_thread) {
+            fail("process " + std::to_string(index) + ": its threads are not in the thread table");
+        }
+        next_thread += process.num_threads;
+    }
+    if (next_thread != header.num_threads) {
+        fail("the thread table has threads that belong to no process");
+    }
+
+    uint64_t next_burst = 0;
+    for (uint32_t index = 0; index < header.num_threads; ++index) {
+        const BinaryTraceThread& thread = threads[index];
+        if (thread.arrival_time < 0) {
+            fail("thread " + std::to_string(index) + ": arrival times cannot be negative");
+        }
+        if ((thread.relative_deadline != -1 && thread.relative_deadline <= 0) || (thread.period != -1 && thread.period <= 0)) {
+            fail("thread " + std::to_string(index) + ": deadlines and periods must be positive");
+        }
+        if (thread.num_bursts % 2 == 0) {
+            fail("thread " + std::to_string(index) + ": a thread must have an odd number of bursts");
+        }
+        if (thread.first_burst != next_burst || thread.num_bursts > header.num_bursts - next_burst) {
+            fail("thread " + std::to_string(index) + ": its bursts are not in the burst table");
+        }
+        next_burst += thread.num_bursts;
+    }
+    if (next_burst != header.num_bursts) {
+        fail("the burst table has bursts that belong to no thread");
+    }
+
+    for (uint64_t index = 0; index < header.num_bursts; ++index) {
+        if (burst_table[index] <= 0) {
+            fail("burst " + std::to_string(index) + ": burst lengths must be positive");
+        }
+    }
+
+    std::vector<bool> seen(header.num_threads, false);
+    for (uint32_t index = 0; index < header.num_threads; ++index) {
+        uint32_t thread = arrival_order[index];
+        if (thread >= header.num_threads || seen[thread]) {
+            fail("the arrival order is not a permutation of the thread table");
+        }
+        seen[thread] = true;
+
+        if (index > 0) {
+            const BinaryTraceThread& previous = threads[arrival_order[index - 1]];
+            if (previous.arrival_time > threads[thread].arrival_time ||
+                (previous.arrival_time == threads[thread].arrival_time && arrival_order[index - 1] > thread)) {
+                fail("the arrival order is not sorted by arrival time");
+            }
+        }
+    }
+}
+
+bool BinaryTrace::matches(const char* data, size_t size) {
+    return size >= sizeof(BINARY_TRACE_MAGIC) && std::memcmp(data, BINARY_TRACE_MAGIC, sizeof(BINARY_TRACE_MAGIC)) == 0;
+}
+
+size_t BinaryTrace::process_index(size_t thread) const {
+    // Processes own consecutive ranges of the thread table, so the owner is the last process
+    // starting at or before the thread. Processes without threads share their start with the
+    // next process, so skip past them.
+    const BinaryTraceProcess* end = processes + file_header->num_processes;
+    const BinaryTraceProcess* owner = std::upper_bound(processes, end, thread,
+        [](size_t index, const BinaryTraceProcess& process) { return index < process.first_thread; });
+    return (owner - processes) - 1;
+}
+
+std::shared_ptr<Thread> BinaryTrace::make_thread(size_t process, uint32_t thread_id) const {
+    const BinaryTraceProcess& process_entry = processes[process];
+    const BinaryTraceThread& thread_entry = threads[process_entry.first_thread + thread_id];
+    auto thread = std::make_shared<Thread>(thread_entry.arrival_time, thread_id, process_entry.process_id, (ProcessPriority)process_entry.priority);
+    thread->relative_deadline = thread_entry.relative_deadline;
+    thread->period = thread_entry.period;
+    thread->tickets = process_entry.tickets;
+
+    // Shares ownership of the mapping, but points at the thread's first burst
+    thread->set_bursts(std::shared_ptr<const int32_t>(file, bursts(thread_entry)), thread_entry.num_bursts);
+
+    return thread;
+}
+
+Workload BinaryTrace::to_workload() const {
+    Workload workload;
+    workload.thread_switch_overhead = file_header->thread_switch_overhead;
+    workload.process_switch_overhead = file_header->process_switch_overhead;
+    workload.processes.reserve(file_header->num_processes);
+
+    for (uint32_t index = 0; index < file_header->num_processes; ++index) {
+        const BinaryTraceProcess& entry = processes[index];
+        auto process = std::make_shared<Process>(entry.process_id, (ProcessPriority)entry.priority);
+        process->tickets = entry.tickets;
+
+        process->threads.reserve(entry.num_threads);
+        for (uint32_t thread_id = 0; thread_id < entry.num_threads; ++thread_id) {
+            process->threads.push_back(make_thread(index, thread_id));
+        }
+
+        workload.processes.push_back(process);
+    }
+
+    return workload;
+}
+
+void BinaryTrace::fail(const std::string& message) const {
+    throw std::runtime_error(source + ": " + message);
+}
+
+void write_binary_trace(const Workload& workload, const std::string& filename) {
+    BinaryTraceHeader header = {};
+    std::memcpy(header.magic, BINARY_TRACE_MAGIC, sizeof(BINARY_TRACE_MAGIC));
+    header.version = BINARY_TRACE_VERSION;
+    header.num_processes = workload.processes.size();
+    header.thread_switch_overhead = workload.thread_switch_overhead;
+    header.process_switch_overhead = workload.process_switch_overhead;
+
+    std::vector<BinaryTraceProcess> processes;
+    std::vector<BinaryTraceThread> threads;
+    std::vector<int32_t> bursts;
+
+    processes.reserve(workload.processes.size());
+    for (const auto& process : workload.processes) {
+        processes.push_back({process->process_id, process->priority, uint32_t(threads.size()), uint32_t(process->threads.size()), process->tickets, 0});
+
+        for (const auto& thread : process->threads) {
+            threads.push_back({thread->arrival_time, thread->num_bursts, uint64_t(bursts.size()), thread->relative_deadline, thread->period});
+            bursts.insert(bursts.end(), thread->bursts.get(), thread->bursts.get() + thread->num_bursts);
+        }
+    }
+
+    header.num_threads = threads.size();
+    header.num_bursts = bursts.size();
+
+    std::vector<uint32_t> arrival_order(threads.size());
+    for (uint32_t index = 0; index < arrival_order.size(); ++index) {
+        arrival_order[index] = index;
+    }
+    std::stable_sort(arrival_order.begin(), arrival_order.end(), [&](uint32_t thread_1, uint32_t thread_2) {
+        return threads[thread_1].arrival_time < threads[thread_2].arrival_time;
+    });
+    if (arrival_order.size() % 2 != 0) {
+        arrival_order.push_back(0);
+    }
+
+    std::ofstream output(filename, std::ios::binary | std::ios::trunc);
+    if (!output) {
+        throw std::runtime_error("Unable to create " + filename + ".");
+    }
+
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    output.write(reinterpret_cast<const char*>(processes.data()), processes.size() * sizeof(BinaryTraceProcess));
+    output.write(reinterpret_cast<const char*>(threads.data()), threads.size() * sizeof(BinaryTraceThread));
+    output.write(reinterpret_cast<const char*>(arrival_order.data()), arrival_order.size() * sizeof(uint32_t));
+    output.write(reinterpret_cast<const char*>(bursts.data()), bursts.size() * sizeof(int32_t));
+
+    if (!output) {
+        throw std::runtime_error("Unable to write " + filename + ".");
+    }
+}
+
+Workload read_binary_trace(std::shared_ptr<const MappedFile> file, const std::string& source) {
+    return BinaryTrace(file, source).to_workload();
+}
+
+int run_convert(int argc, char* const argv[]) {
+    if (argc != 3) {
+        std::cerr << "Usage: cpu-sim convert input output" << std::endl;
+        return 1;
+    }
+
+    try {
+        write_binary_trace(Simulation::read_file(argv[1]), argv[2]);
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
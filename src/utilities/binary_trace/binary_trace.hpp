@@ -0,0 +1,197 @@
+#ifndef BINARY_TRACE_HPP
+#define BINARY_TRACE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "types/thread/thread.hpp"
+#include "types/workload/workload.hpp"
+#include "utilities/mapped_file/mapped_file.hpp"
+
+/*
+    The binary simulation file format.
+
+    A binary simulation file holds exactly the same information as a text one, laid out so it
+    can be mapped into memory and read in place. All values are little-endian, and every table
+    starts on an 8 byte boundary:
+
+        BinaryTraceHeader       header
+        BinaryTraceProcess      processes[header.num_processes]
+        BinaryTraceThread       threads[header.num_threads]
+        uint32_t                arrival_order[header.num_threads]   (padded to 8 bytes)
+        int32_t                 bursts[header.num_bursts]
+
+    Threads are stored in the same order as in the text file, grouped by process. Each thread's
+    bursts are contiguous and alternate between CPU and IO, starting and ending with a CPU burst.
+    arrival_order lists the thread table indices sorted by arrival time, with threads that arrive
+    at the same time kept in file order, so a reader can walk the arrivals without sorting them.
+    A thread's relative_deadline and period, and a process's tickets, are -1 when the text file
+    did not give them.
+
+    Files are written with "cpu-sim convert input output", and are recognized by their magic
+    number wherever a simulation file can be given.
+*/
+
+/*
+    BINARY_TRACE_MAGIC / BINARY_TRACE_VERSION:
+        The first 8 bytes of every binary simulation file, and the version of the layout above.
+        The version must be bumped whenever the layout changes.
+*/
+const char BINARY_TRACE_MAGIC[8] = {'C', 'P', 'U', 'S', 'I', 'M', 'B', 'T'};
+
+const uint32_t BINARY_TRACE_VERSION = 3;
+
+struct BinaryTraceHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t num_processes;
+    uint32_t num_threads;
+    int32_t thread_switch_overhead;
+    int32_t process_switch_overhead;
+    uint32_t reserved;
+    uint64_t num_bursts;
+};
+
+struct BinaryTraceProcess {
+    int32_t process_id;
+    int32_t priority;
+    uint32_t first_thread;
+    uint32_t num_threads;
+    int32_t tickets;
+    uint32_t reserved;
+};
+
+struct BinaryTraceThread {
+    int32_t arrival_time;
+    uint32_t num_bursts;
+    uint64_t first_burst;
+    int32_t relative_deadline;
+    int32_t period;
+};
+
+static_assert(sizeof(BinaryTraceHeader) == 40, "unexpected BinaryTraceHeader padding");
+static_assert(sizeof(BinaryTraceProcess) == 24, "unexpected BinaryTraceProcess padding");
+static_assert(sizeof(BinaryTraceThread) == 24, "unexpected BinaryTraceThread padding");
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "binary simulation files are little-endian");
+
+/*
+    BinaryTrace:
+        A checked, read-only view of a mapped binary simulation file. The constructor validates the header and that every table
+        and burst range lies within the file, so the accessors do no checking of their own.
+
+        Errors are thrown as a std::runtime_error naming the source, like:
+            trace.bin: the thread table does not fit in the file
+*/
+
+class BinaryTrace {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        BinaryTrace(file, source):
+            Validates the mapped binary simulation file. The view, and every thread built
+            from it, shares ownership of the mapping. The source (usually the filename) is
+            only used in error messages.
+    */
+    BinaryTrace(std::shared_ptr<const MappedFile> file, const std::string& source);
+
+    /*
+        matches(data, size):
+            Returns true if the data starts with the binary simulation file magic number.
+    */
+    static bool matches(const char* data, size_t size);
+
+    const BinaryTraceHeader& header() const { return *file_header; }
+
+    const BinaryTraceProcess& process(size_t index) const { return processes[index]; }
+
+    const BinaryTraceThread& thread(size_t index) const { return threads[index]; }
+
+    /*
+        arrival(index):
+            The thread table index of the index-th thread to arrive.
+    */
+    uint32_t arrival(size_t index) const { return arrival_order[index]; }
+
+    /*
+        bursts(thread):
+            The first burst length of the thread. The thread's other bursts follow it.
+    */
+    const int32_t* bursts(const BinaryTraceThread& thread) const { return burst_table + thread.first_burst; }
+
+    /*
+        process_index(thread):
+            The process table index of the process that the thread table entry belongs to.
+    */
+    size_t process_index(size_t thread) const;
+
+    /*
+        make_thread(process, thread_id):
+            Builds the thread_id-th thread of the process at the given process table index.
+            Its bursts point into the mapped burst table, so nothing is allocated for them.
+    */
+    std::shared_ptr<Thread> make_thread(size_t process, uint32_t thread_id) const;
+
+    /*
+        to_workload():
+            Builds the processes, threads and bursts for a simulation.
+    */
+    Workload to_workload() const;
+
+private:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    std::shared_ptr<const MappedFile> file;
+
+    const BinaryTraceHeader* file_header;
+
+    const BinaryTraceProcess* processes;
+
+    const BinaryTraceThread* threads;
+
+    const uint32_t* arrival_order;
+
+    const int32_t* burst_table;
+
+    std::string source;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        fail(message):
+            Throws a std::runtime_error naming the source.
+    */
+    [[noreturn]] void fail(const std::string& message) const;
+};
+
+/*
+    write_binary_trace(workload, filename):
+        Writes the workload as a binary simulation file. Throws a std::runtime_error if the
+        file cannot be written.
+*/
+void write_binary_trace(const Workload& workload, const std::string& filename);
+
+/*
+    read_binary_trace(file, source):
+        Validates a mapped binary simulation file and builds the workload from it.
+*/
+Workload read_binary_trace(std::shared_ptr<const MappedFile> file, const std::string& source);
+
+/*
+    run_convert(argc, argv):
+        The entry point for "cpu-sim convert input output". Reads a simulation file in
+        either format and writes it as a binary simulation file.
+*/
+int run_convert(int argc, char* const argv[]);
+
+#endif
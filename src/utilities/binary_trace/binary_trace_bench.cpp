@@ -0,0 +1,67 @@
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+
+#include "simulation/simulation.hpp"
+#include "utilities/benchmark/benchmark.hpp"
+#include "utilities/binary_trace/binary_trace.hpp"
+#include "utilities/mapped_file/mapped_file.hpp"
+
+/*
+    Compares loading the same generated workload from a text simulation file and from
+    its binary conversion.
+*/
+
+namespace {
+
+std::string make_temporary_file() {
+    char filename[] = "/tmp/cpu-sim-bench-XXXXXX";
+    int fd = mkstemp(filename);
+    if (fd == -1) {
+        throw std::runtime_error("Unable to create a temporary file.");
+    }
+    close(fd);
+    return filename;
+}
+
+size_t count_threads(const Workload& workload) {
+    size_t threads = 0;
+    for (const auto& process : workload.processes) {
+        threads += process->threads.size();
+    }
+    return threads;
+}
+
+}
+
+BENCHMARK(binary_trace_load) {
+    std::string text_filename = make_temporary_file();
+    std::string binary_filename = make_temporary_file();
+
+    write_random_trace(text_filename, 100, 100, 200);
+    write_binary_trace(Simulation::read_file(text_filename), binary_filename);
+    size_t bytes = MappedFile(binary_filename).size();
+
+    size_t threads = 0;
+    double text_seconds = time_best_of(3, [&] {
+        threads = count_threads(Simulation::read_file(text_filename));
+    });
+
+    double binary_seconds = time_best_of(3, [&] {
+        threads = count_threads(Simulation::read_file(binary_filename));
+    });
+
+    // Just validating the file, without building the threads
+    double validate_seconds = time_best_of(3, [&] {
+        BinaryTrace trace(std::make_shared<const MappedFile>(binary_filename), binary_filename);
+        threads = trace.header().num_threads;
+    });
+
+    std::remove(text_filename.c_str());
+    std::remove(binary_filename.c_str());
+
+    report("text workload", text_seconds, threads, "threads");
+    report("binary workload (" + std::to_string(bytes >> 20) + " MiB)", binary_seconds, threads, "threads");
+    report("binary validation only", validate_seconds, threads, "threads");
+}
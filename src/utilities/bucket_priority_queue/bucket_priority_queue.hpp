@@ -0,0 +1,120 @@
+/**
+ * A stable priority queue for a small, fixed range of priorities: 0 up to LEVELS - 1, where
+ * lower numbers come out first. It has the same interface as Stable_Priority_Queue.
+ *
+ * Every priority has its own FIFO ring buffer, and a bitmap records which of them are non-empty,
+ * so finding the top element is a single count-trailing-zeros instruction no matter how many
+ * elements are queued, and pushing or popping never allocates once the buffers have grown.
+ * Priority classes (0..3) are the intended use.
+ */
+
+#ifndef BUCKET_PRIORITY_QUEUE
+#define BUCKET_PRIORITY_QUEUE
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Everything is defined in-line since this is templated.
+template <class T, int LEVELS>
+class Bucket_Priority_Queue {
+    static_assert(LEVELS > 0 && LEVELS <= 64, "the non-empty levels must fit in a 64 bit mask");
+
+ private:
+    // A FIFO queue in a power-of-two sized buffer, indexed modulo its capacity
+    struct Level {
+        std::vector<T> buffer;
+        size_t head = 0;
+        size_t count = 0;
+
+        void push(const T& item) {
+            if (count == buffer.size()) {
+                grow();
+            }
+            buffer[(head + count) & (buffer.size() - 1)] = item;
+            ++count;
+        }
+
+        void pop() {
+            // Resetting the slot lets go of whatever the element owns
+            buffer[head] = T();
+            head = (head + 1) & (buffer.size() - 1);
+            --count;
+        }
+
+        void grow() {
+            std::vector<T> bigger(buffer.empty() ? 8 : buffer.size() * 2);
+            for (size_t index = 0; index < count; ++index) {
+                bigger[index] = std::move(buffer[(head + index) & (buffer.size() - 1)]);
+            }
+            buffer.swap(bigger);
+            head = 0;
+        }
+    };
+
+    std::array<Level, LEVELS> mLevels;
+    uint64_t mNonEmpty = 0;
+    int mSize = 0;
+
+    int top_level() const {
+        return __builtin_ctzll(mNonEmpty);
+    }
+
+ public:
+    Bucket_Priority_Queue() {}
+
+    /**
+     * Is this queue empty? Equivalent to .size() == 0
+     */
+    bool empty() const {
+        return mSize == 0;
+    }
+
+    /**
+     * Returns the number of elements stored
+     */
+    int size() const {
+        return mSize;
+    }
+
+    /**
+     * Retrieve the top element
+     */
+    const T& top() const {
+        if (mNonEmpty == 0) {
+            throw std::runtime_error("Attempted to pop from empty queue!");
+        }
+        const Level& level = mLevels[top_level()];
+        return level.buffer[level.head];
+    }
+
+    /**
+     * Removes the top element
+     */
+    void pop() {
+        int index = top_level();
+        Level& level = mLevels[index];
+        level.pop();
+        if (level.count == 0) {
+            mNonEmpty &= ~(uint64_t(1) << index);
+        }
+        --mSize;
+    }
+
+    /**
+     * Adds an item into the queue. The priority must be between 0 and LEVELS - 1.
+     */
+    void push(int priority, const T& item) {
+        if (priority < 0 || priority >= LEVELS) {
+            throw std::out_of_range("Priority " + std::to_string(priority) + " is outside of the queue's range.");
+        }
+        mLevels[priority].push(item);
+        mNonEmpty |= uint64_t(1) << priority;
+        ++mSize;
+    }
+};
+
+#endif  // BUCKET_PRIORITY_QUEUE
@@ -0,0 +1,113 @@
+#ifndef CHECKPOINT_HPP
+#define CHECKPOINT_HPP
+
+#include <cstdint>
+
+/*
+    The checkpoint file format.
+
+    A checkpoint holds everything about a simulation in progress that is not in its simulation
+    file: the pending events, the ready queue, how far along each thread and CPU is, and the
+    statistics gathered so far. Restoring one needs the same simulation file and flags that it
+    was saved with. All values are little-endian, and every table starts on an 8 byte boundary:
+
+        CheckpointHeader        header
+        CheckpointCore          cores[header.num_cpus]
+        CheckpointThread        threads[header.num_threads]
+        CheckpointEvent         events[header.num_events]
+        uint32_t                ready_threads[header.num_ready]     (padded to 8 bytes)
+        uint64_t                idle_intervals[header.num_idle_buckets]
+
+    Threads are numbered in the order of their processes' IDs, then by thread ID, which is the
+    order the simulation keeps them in, and every other table refers to them by that number,
+    or by -1 for none. Events are stored in the order they will be handled. ready_threads lists
+    the ready queue in the order the scheduler would choose the threads (see
+    Scheduler::ready_threads()).
+
+    Checkpoints are written with the -k, --checkpoint_every flag, and read with -r, --restore.
+*/
+
+/*
+    CHECKPOINT_MAGIC / CHECKPOINT_VERSION:
+        The first 8 bytes of every checkpoint, and the version of the layout above. The version
+        must be bumped whenever the layout or anything saved in it changes.
+*/
+const char CHECKPOINT_MAGIC[8] = {'C', 'P', 'U', 'S', 'I', 'M', 'C', 'K'};
+
+const uint32_t CHECKPOINT_VERSION = 2;
+
+struct CheckpointHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t num_cpus;
+    uint32_t num_processes;
+    uint32_t num_threads;
+    uint32_t num_events;
+    uint32_t num_ready;
+    uint32_t num_idle_buckets;
+    uint32_t event_num;
+    char algorithm[16];
+    int32_t time_slice;
+    int32_t thread_switch_overhead;
+    int32_t process_switch_overhead;
+    int32_t scheduler_time_slice;
+    uint32_t scheduler_time;
+    uint32_t reserved;
+    uint64_t events_handled;
+    uint64_t total_time;
+    uint64_t dispatch_time;
+    uint64_t total_idle_time;
+    uint64_t migrations;
+    uint64_t dispatches_coalesced;
+};
+
+struct CheckpointCore {
+    int32_t active_thread;
+    int32_t prev_thread;
+    int32_t time_slice;
+    int32_t burst_event;
+    uint32_t burst_end_time;
+    uint32_t idle_since;
+    uint32_t running_dispatcher_invoked;
+    uint32_t reserved;
+    uint64_t service_time;
+    uint64_t dispatch_time;
+    uint64_t idle_time;
+};
+
+struct CheckpointThread {
+    int32_t start_time;
+    int32_t end_time;
+    int32_t service_time;
+    int32_t io_time;
+    int32_t state_change_time;
+    int32_t current_state;
+    int32_t previous_state;
+    uint32_t next_burst;
+    int32_t remaining_time;
+    int32_t burst_estimate;
+    int32_t mlfq_time;
+    int32_t last_queue_level;
+    int32_t prev_service_time;
+    int32_t last_cpu;
+    int32_t run_queue;
+    uint32_t reserved;
+    int64_t stride_pass;
+};
+
+struct CheckpointEvent {
+    int32_t type;
+    uint32_t time;
+    uint32_t event_num;
+    int32_t thread;
+    int32_t cpu;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(CheckpointHeader) == 128, "unexpected CheckpointHeader padding");
+static_assert(sizeof(CheckpointCore) == 56, "unexpected CheckpointCore padding");
+static_assert(sizeof(CheckpointThread) == 72, "unexpected CheckpointThread padding");
+static_assert(sizeof(CheckpointEvent) == 24, "unexpected CheckpointEvent padding");
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "checkpoints are little-endian");
+
+#endif
@@ -0,0 +1,104 @@
+/**
+ * A Fenwick (binary indexed) tree of non-negative weights, one per index. Changing a weight,
+ * the running total, and finding the index a point in the cumulative weights falls in all take
+ * O(log n) time, which is what a lottery draw needs: find(ticket) is the index holding the
+ * winning ticket.
+ */
+
+#ifndef FENWICK_TREE
+#define FENWICK_TREE
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+// Everything is defined in-line, like the queues next to it in utilities.
+class Fenwick_Tree {
+ private:
+    // mTree[i] holds the sum of the weights of indices i - (i & -i) up to i - 1, so mTree[0] is unused
+    std::vector<int64_t> mTree = {0};
+    std::vector<int64_t> mWeights;
+    int64_t mTotal = 0;
+
+ public:
+    Fenwick_Tree() {}
+
+    /**
+     * Returns the number of indices
+     */
+    size_t size() const {
+        return mWeights.size();
+    }
+
+    /**
+     * Returns the sum of every weight
+     */
+    int64_t total() const {
+        return mTotal;
+    }
+
+    /**
+     * Returns the weight at an index
+     */
+    int64_t weight(size_t index) const {
+        return mWeights[index];
+    }
+
+    /**
+     * Adds indices with a weight of 0 until there are the given number of them
+     */
+    void resize(size_t size) {
+        if (size < mWeights.size()) {
+            throw std::invalid_argument("A Fenwick tree cannot shrink.");
+        }
+        mWeights.resize(size, 0);
+
+        // Rebuilding takes linear time, since every node only adds itself to its parent
+        mTree.assign(size + 1, 0);
+        for (size_t node = 1; node <= size; ++node) {
+            mTree[node] += mWeights[node - 1];
+            size_t parent = node + (node & -node);
+            if (parent <= size) {
+                mTree[parent] += mTree[node];
+            }
+        }
+    }
+
+    /**
+     * Sets the weight at an index
+     */
+    void set(size_t index, int64_t weight) {
+        int64_t delta = weight - mWeights[index];
+        mWeights[index] = weight;
+        mTotal += delta;
+        for (size_t node = index + 1; node < mTree.size(); node += node & -node) {
+            mTree[node] += delta;
+        }
+    }
+
+    /**
+     * Returns the index whose weight covers the given point, where the weights are laid end
+     * to end in index order. The point must be at least 0 and less than total().
+     */
+    size_t find(int64_t point) const {
+        if (point < 0 || point >= mTotal) {
+            throw std::out_of_range("Attempted to find a point outside of a Fenwick tree.");
+        }
+
+        // Descend from the largest power of two, skipping every node that ends at or before the point
+        size_t node = 0;
+        size_t step = 1;
+        while (step * 2 < mTree.size()) {
+            step *= 2;
+        }
+        for (; step > 0; step /= 2) {
+            if (node + step < mTree.size() && mTree[node + step] <= point) {
+                node += step;
+                point -= mTree[node];
+            }
+        }
+        return node;
+    }
+};
+
+#endif  // FENWICK_TREE
@@ -1,8 +1,12 @@
 #include "utilities/flags/flags.hpp"
 
+#include "algorithms/scheduler_factory.hpp"
+
 void print_usage() {
     std::cout <<
         "Usage: cpu-sim [options] filename\n"
+        "       cpu-sim sweep [options] filename\n"
+        "       cpu-sim convert input output\n"
         "\n"
         "Options\n"
         "   -h, --help:\n"
@@ -24,10 +28,75 @@ void print_usage() {
         "       The scheduling algorithm to use. Valid values are:\n"
         "           FCFS: first-come, first-served (default)\n"
         "           SPN: shortest process next\n"
+        "           SRT: shortest remaining time, using estimated burst lengths\n"
+        "           SRT-ORACLE: shortest remaining time, using the actual burst lengths\n"
+        "           HRRN: highest response ratio next, using estimated burst lengths\n"
+        "           HRRN-ORACLE: highest response ratio next, using the actual burst lengths\n"
         "           RR: round-robin scheduling\n"
         "           PRIORITY: priority scheduling\n"
+        "           PPRIORITY: priority scheduling, preempting lower priority threads\n"
+        "           LOTTERY: lottery scheduling, with tickets by priority or from the simulation file\n"
+        "           STRIDE: stride scheduling, with tickets by priority or from the simulation file\n"
         "           MLFQ: multilevel feedback queue\n"
-        "           CFS: completely-fair scheduling\n";
+        "           CFS: completely-fair scheduling\n"
+        "           EDF: earliest deadline first, preempting threads with later deadlines\n"
+        "           RM: rate-monotonic, preempting threads with longer periods\n"
+        "\n"
+        "   -l, --mlfq_levels <value>:\n"
+        "       The number of MLFQ levels, from 1 to 64 (default 10). Level i has a quantum of 2^i ticks.\n"
+        "\n"
+        "   -q, --mlfq_quanta <list>:\n"
+        "       The quantum of each MLFQ level in ticks, highest level first, like 1,2,4,8. Sets the number\n"
+        "       of levels, which must match --mlfq_levels if both are given.\n"
+        "\n"
+        "   -e, --event_queue <queue>:\n"
+        "       The event queue backend to use. Does not change the output. Valid values are:\n"
+        "           heap: a binary heap (default)\n"
+        "           wheel: a timing wheel, faster for large simulation files\n"
+        "\n"
+        "   -c, --cpus <value>:\n"
+        "       The number of CPUs to simulate (default 1). Must be greater than zero.\n"
+        "\n"
+        "   -p, --per_cpu_queues:\n"
+        "       If set, each CPU has its own run queue using the chosen algorithm.\n"
+        "\n"
+        "   -b, --balance <policy>:\n"
+        "       How per-CPU run queues are balanced. Valid values are:\n"
+        "           none: threads stay on their CPU's run queue\n"
+        "           steal: idle CPUs steal from the longest run queue (default)\n"
+        "           periodic: run queues are rebalanced every balance_interval ticks\n"
+        "           both: steal and periodic\n"
+        "\n"
+        "   -i, --balance_interval <value>:\n"
+        "       The number of ticks between periodic rebalances (default 100). Must be greater than zero.\n"
+        "\n"
+        "   -S, --stream:\n"
+        "       If set, threads are read from the simulation file as they arrive and released once they\n"
+        "       finish, so memory use follows the number of live threads. Needs a binary simulation file\n"
+        "       (see cpu-sim convert). Does not change the output.\n"
+        "\n"
+        "   -d, --coalesce_dispatches:\n"
+        "       If set, a CPU that would run its dispatcher only to find no ready threads goes idle\n"
+        "       without one. Does not change the output, other than counting the dispatches saved.\n"
+        "\n"
+        "   -B, --batch_events:\n"
+        "       If set, all the events at the same time are taken off the event queue at once and then\n"
+        "       handled in order. Does not change the output.\n"
+        "\n"
+        "   -I, --idle_histogram:\n"
+        "       If set, outputs how many times the CPUs sat idle for each range of lengths.\n"
+        "\n"
+        "   -k, --checkpoint_every <value>[e|t]:\n"
+        "       Save a checkpoint every value events, or every value ticks if followed by t. Each checkpoint\n"
+        "       replaces the last. Works with the FCFS, SPN, RR, PRIORITY, PPRIORITY and MLFQ algorithms,\n"
+        "       but not with streaming or per-CPU run queues. Does not change the output.\n"
+        "\n"
+        "   -K, --checkpoint_file <file>:\n"
+        "       Where to save checkpoints (default: the simulation filename followed by .checkpoint).\n"
+        "\n"
+        "   -r, --restore <file>:\n"
+        "       Continue the simulation from a checkpoint, which must have been saved from the same simulation\n"
+        "       file with the same algorithm, time slice and number of CPUs.\n";
 }
 
 
@@ -43,6 +112,20 @@ int parse_flags(int argc, char* const argv[], FlagOptions& flags) {
         {"verbose",     no_argument,        0, 'v'},
         {"algorithm",   required_argument,  0, 'a'},
         {"time_slice",  required_argument,  0, 's'},
+        {"event_queue", required_argument,  0, 'e'},
+        {"mlfq_levels", required_argument,  0, 'l'},
+        {"mlfq_quanta", required_argument,  0, 'q'},
+        {"cpus",        required_argument,  0, 'c'},
+        {"per_cpu_queues",   no_argument,       0, 'p'},
+        {"balance",          required_argument, 0, 'b'},
+        {"balance_interval", required_argument, 0, 'i'},
+        {"stream",           no_argument,       0, 'S'},
+        {"coalesce_dispatches", no_argument,    0, 'd'},
+        {"batch_events",     no_argument,       0, 'B'},
+        {"idle_histogram",   no_argument,       0, 'I'},
+        {"checkpoint_every", required_argument, 0, 'k'},
+        {"checkpoint_file",  required_argument, 0, 'K'},
+        {"restore",          required_argument, 0, 'r'},
         {"help",        no_argument,        0, 'h'},
         {0, 0, 0, 0}
     };
@@ -52,7 +135,7 @@ int parse_flags(int argc, char* const argv[], FlagOptions& flags) {
 
     // Parse flags entered by the user.
     while (true) {
-        flag_char = getopt_long(argc, argv, "-s:tvhma:", flag_options, &option_index);
+        flag_char = getopt_long(argc, argv, "-s:tvhma:e:l:q:c:pb:i:SdBIk:K:r:", flag_options, &option_index);
 
         // Detect the end of the options.
         if (flag_char == -1) {
@@ -76,6 +159,100 @@ int parse_flags(int argc, char* const argv[], FlagOptions& flags) {
                 flags.scheduler = get_scheduler();
                 break;
 
+            case 'e':
+                if (!get_event_queue(optarg, flags.event_queue)) { return 1; }
+                break;
+
+            case 'l':
+                try {
+                    flags.mlfq_levels = std::stoi(optarg);
+                    if (flags.mlfq_levels <= 0) { return 1; }
+                } catch (...) {
+                    return 1;
+                }
+                break;
+
+            case 'q': {
+                std::stringstream quanta(optarg);
+                std::string quantum;
+                flags.mlfq_quanta.clear();
+                while (std::getline(quanta, quantum, ',')) {
+                    try {
+                        flags.mlfq_quanta.push_back(std::stoi(quantum));
+                        if (flags.mlfq_quanta.back() <= 0) { return 1; }
+                    } catch (...) {
+                        return 1;
+                    }
+                }
+                if (flags.mlfq_quanta.empty()) { return 1; }
+                break;
+            }
+
+            case 'c':
+                try {
+                    flags.num_cpus = std::stoi(optarg);
+                    if (flags.num_cpus <= 0) { return 1; }
+                } catch (...) {
+                    return 1;
+                }
+                break;
+
+            case 'p':
+                flags.per_cpu_queues = true;
+                break;
+
+            case 'b':
+                flags.balance = optarg;
+                std::transform(flags.balance.begin(), flags.balance.end(), flags.balance.begin(), ::tolower);
+                if (flags.balance != "none" && flags.balance != "steal" && flags.balance != "periodic" && flags.balance != "both") { return 1; }
+                break;
+
+            case 'i':
+                try {
+                    flags.balance_interval = std::stoi(optarg);
+                    if (flags.balance_interval <= 0) { return 1; }
+                } catch (...) {
+                    return 1;
+                }
+                break;
+
+            case 'S':
+                flags.stream = true;
+                break;
+
+            case 'd':
+                flags.coalesce_dispatches = true;
+                break;
+
+            case 'B':
+                flags.batch_events = true;
+                break;
+
+            case 'I':
+                flags.idle_histogram = true;
+                break;
+
+            case 'k':
+                try {
+                    size_t length;
+                    long long every = std::stoll(optarg, &length);
+                    std::string unit = std::string(optarg).substr(length);
+                    if (every <= 0 || (unit != "" && unit != "e" && unit != "t")) { return 1; }
+                    flags.checkpoint_every = every;
+                    flags.checkpoint_ticks = unit == "t";
+                } catch (...) {
+                    return 1;
+                }
+                break;
+
+            case 'K':
+                flags.checkpoint_file = optarg;
+                break;
+
+            case 'r':
+                flags.restore = optarg;
+                break;
+
             case 'h':
                 return 1;
                 break;
@@ -117,9 +294,9 @@ std::string get_scheduler() {
     std::string input(optarg);
     std::string input_algorithm = input;
     std::transform(input_algorithm.begin(), input_algorithm.end(), input_algorithm.begin(), ::toupper);
-    std::string valid_algorithms[] = {"FCFS", "SPN", "RR", "PRIORITY", "MLFQ", "CFS"};
+    const std::vector<std::string>& valid_algorithms = available_algorithms();
 
-    bool valid = std::find(std::begin(valid_algorithms), std::end(valid_algorithms), input_algorithm) != std::end(valid_algorithms);
+    bool valid = std::find(valid_algorithms.begin(), valid_algorithms.end(), input_algorithm) != valid_algorithms.end();
 
     if (valid) {
         return input_algorithm;
@@ -128,3 +305,9 @@ std::string get_scheduler() {
     }
     return "";
 }
+
+bool get_event_queue(const std::string& value, std::string& event_queue) {
+    event_queue = value;
+    std::transform(event_queue.begin(), event_queue.end(), event_queue.begin(), ::tolower);
+    return event_queue == "heap" || event_queue == "wheel";
+}
@@ -6,7 +6,9 @@
 #include <fstream>
 #include <getopt.h>
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <vector>
 
 /*
     FlagOptions:
@@ -24,8 +26,7 @@ public:
 
     /*
         filename:
-            The filename that the simulation should read from. If it is empty (""),
-            then the simulation should read from stdin.
+            The filename that the simulation should read from. It must be given.
     */
     std::string filename = "";
 
@@ -63,6 +64,17 @@ public:
     */
     int time_slice = -1;
 
+    /*
+        mlfq_levels / mlfq_quanta:
+            The number of MLFQ levels, or 0 for the default of 10, and the quantum of each
+            level, or empty for 2^i ticks in level i. If both are given, the number of quanta
+            must match the number of levels.
+
+            Set with the -l, --mlfq_levels and -q, --mlfq_quanta flags.
+    */
+    int mlfq_levels = 0;
+    std::vector<int> mlfq_quanta;
+
     /*
         scheduler:
             A string representing the scheduling algorithm that the
@@ -71,6 +83,112 @@ public:
             Set with the -a, --algorithm flag.
     */
     std::string scheduler = "";
+
+    /*
+        event_queue:
+            Which event queue backend the simulation should use, either "heap" or "wheel".
+
+            Set with the -e, --event_queue flag.
+    */
+    std::string event_queue = "heap";
+
+    /*
+        num_cpus:
+            The number of CPUs to simulate. Should be positive.
+
+            Set with the -c, --cpus flag.
+    */
+    int num_cpus = 1;
+
+    /*
+        per_cpu_queues:
+            Whether each CPU should have its own run queue instead of sharing one.
+
+            Set to true with the -p, --per_cpu_queues flag.
+    */
+    bool per_cpu_queues = false;
+
+    /*
+        balance:
+            How per-CPU run queues are balanced: "none", "steal" (idle CPUs steal from the
+            longest run queue), "periodic" (rebalance every balance_interval ticks) or "both".
+
+            Set with the -b, --balance flag.
+    */
+    std::string balance = "steal";
+
+    /*
+        balance_interval:
+            How many ticks apart periodic rebalancing happens. Should be positive.
+
+            Set with the -i, --balance_interval flag.
+    */
+    int balance_interval = 100;
+
+    /*
+        stream:
+            Whether threads should be read from the simulation file as the simulation reaches
+            their arrival times, instead of all at once. Needs a binary simulation file.
+
+            Set to true with the -S, --stream flag.
+    */
+    bool stream = false;
+
+    /*
+        coalesce_dispatches:
+            Whether a CPU that finishes with its thread while nothing else can become ready at
+            the same time should go idle right away, instead of adding a DISPATCHER_INVOKED
+            event that would find the ready queue empty. Does not change the output.
+
+            Set to true with the -d, --coalesce_dispatches flag.
+    */
+    bool coalesce_dispatches = false;
+
+    /*
+        batch_events:
+            Whether all the events at the same time should be taken off the event queue together
+            and then handled in order, instead of one at a time. Does not change the output.
+
+            Set to true with the -B, --batch_events flag.
+    */
+    bool batch_events = false;
+
+    /*
+        idle_histogram:
+            Whether to output a histogram of how long the CPUs sat idle each time they went idle.
+
+            Set to true with the -I, --idle_histogram flag.
+    */
+    bool idle_histogram = false;
+
+    /*
+        checkpoint_every / checkpoint_ticks:
+            How often to save a checkpoint of the simulation, or 0 to never save one. Counted
+            in handled events, or in simulated ticks if checkpoint_ticks is set.
+
+            Set with the -k, --checkpoint_every flag, as a number of events with an optional
+            'e' after it, or a number of ticks with a 't' after it.
+    */
+    size_t checkpoint_every = 0;
+    bool checkpoint_ticks = false;
+
+    /*
+        checkpoint_file:
+            Where checkpoints are saved. Each one replaces the last. If it is empty (""), they
+            are saved next to the simulation file, with ".checkpoint" added to its name.
+
+            Set with the -K, --checkpoint_file flag.
+    */
+    std::string checkpoint_file = "";
+
+    /*
+        restore:
+            A checkpoint to continue the simulation from, instead of starting it from the
+            beginning. If it is empty (""), the simulation starts from the beginning.
+
+            Set with the -r, --restore flag.
+    */
+    std::string restore = "";
 };
 
 /*
@@ -93,4 +211,11 @@ int parse_flags(int argc, char* const argv[], FlagOptions& flags);
 */
 std::string get_scheduler();
 
+/*
+    get_event_queue(value, event_queue):
+        Lowercases the value of an -e, --event_queue flag into event_queue. Returns false if
+        it does not name an event queue backend.
+*/
+bool get_event_queue(const std::string& value, std::string& event_queue);
+
 #endif
@@ -0,0 +1,232 @@
+/**
+ * A max priority queue for elements whose priority grows with time: an element pushed with a
+ * start time and a cost has priority (now - start) / cost, which is how HRRN ranks threads
+ * (waiting time over expected service time). Equal priorities come out in FIFO order.
+ *
+ * Since priorities change, no fixed order works, but each one is a line in time, so this is a
+ * kinetic tournament: a complete binary tree over the elements where every match records its
+ * winner and the first time the loser will overtake it. advance(time) replays only the matches
+ * whose time has come, and the ones above them, so a dispatch costs a few O(log n) paths
+ * instead of a scan that recomputes every priority. Time must never move backwards.
+ */
+
+#ifndef KINETIC_PRIORITY_QUEUE
+#define KINETIC_PRIORITY_QUEUE
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Everything is defined in-line since this is templated.
+template <class T>
+class Kinetic_Priority_Queue {
+ private:
+    static constexpr int64_t NEVER = std::numeric_limits<int64_t>::max();
+
+    struct Entry {
+        int64_t start;
+        int64_t cost;
+        uint64_t sequence;
+        T item;
+    };
+
+    using Event = std::pair<int64_t, size_t>;
+
+    // The elements, by slot, and the slots that are free
+    std::vector<Entry> mSlots;
+    std::vector<size_t> mFree;
+
+    // The tree, stored like a heap: node 1 is the root, node n has children 2n and 2n + 1, and
+    // the leaves are nodes mCapacity and up. Each node holds the slot of the element that
+    // wins its subtree, or -1 if the subtree is empty.
+    size_t mCapacity = 0;
+    std::vector<int64_t> mWinners;
+
+    // When each match will flip, or NEVER, and the same times in a heap so the next one to flip
+    // is first. Entries whose time no longer matches mFailures are stale and skipped.
+    std::vector<int64_t> mFailures;
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>> mEvents;
+
+    int64_t mNow = 0;
+    uint64_t mSequence = 0;
+    int mSize = 0;
+
+    static int64_t floor_div(int64_t num, int64_t den) {
+        return num / den - ((num % den != 0) && ((num < 0) != (den < 0)));
+    }
+
+    // Whether a comes out before b at the given time
+    static bool beats(const Entry& a, const Entry& b, int64_t time) {
+        int64_t lhs = (time - a.start) * b.cost;
+        int64_t rhs = (time - b.start) * a.cost;
+        return lhs > rhs || (lhs == rhs && a.sequence < b.sequence);
+    }
+
+    // The first time from now on that the loser comes out before the winner
+    int64_t failure_time(const Entry& winner, const Entry& loser) const {
+        // A loser with the same or a higher cost gains on the winner no faster than the winner
+        // gains on it, so it never catches up
+        int64_t den = winner.cost - loser.cost;
+        if (den <= 0) {
+            return NEVER;
+        }
+
+        // Otherwise it wins once time * den > num, or >= num if it also wins ties
+        int64_t num = loser.start * winner.cost - winner.start * loser.cost;
+        int64_t time = (loser.sequence < winner.sequence) ? -floor_div(-num, den) : floor_div(num, den) + 1;
+        return std::max(time, mNow);
+    }
+
+    // Replays the match at an internal node
+    void play(size_t node) {
+        int64_t left = mWinners[2 * node];
+        int64_t right = mWinners[2 * node + 1];
+        int64_t failure = NEVER;
+
+        if (left == -1 || right == -1) {
+            left = std::max(left, right);
+        } else {
+            if (!beats(mSlots[left], mSlots[right], mNow)) {
+                std::swap(left, right);
+            }
+            failure = failure_time(mSlots[left], mSlots[right]);
+        }
+
+        mWinners[node] = left;
+
+        // An unchanged time is still queued
+        if (failure != mFailures[node]) {
+            mFailures[node] = failure;
+            if (failure != NEVER) {
+                mEvents.push({failure, node});
+            }
+        }
+    }
+
+    // Drops the stale events once they outnumber the matches, so far-off ones do not pile up
+    void compact_events() {
+        if (mEvents.size() <= 2 * mCapacity) {
+            return;
+        }
+        std::vector<Event> events;
+        for (size_t node = 1; node < mCapacity; ++node) {
+            if (mFailures[node] != NEVER) {
+                events.push_back({mFailures[node], node});
+            }
+        }
+        mEvents = decltype(mEvents)(std::greater<Event>(), std::move(events));
+    }
+
+    // Replays every match from a node up to the root
+    void replay_up(size_t node) {
+        for (; node >= 1; node /= 2) {
+            play(node);
+        }
+        compact_events();
+    }
+
+    // Doubles the number of leaves and replays the whole tree
+    void grow() {
+        size_t capacity = (mCapacity == 0) ? 8 : mCapacity * 2;
+        std::vector<int64_t> winners(2 * capacity, -1);
+        for (size_t slot = 0; slot < mCapacity; ++slot) {
+            winners[capacity + slot] = mWinners[mCapacity + slot];
+        }
+        for (size_t slot = capacity; slot-- > mCapacity;) {
+            mFree.push_back(slot);
+        }
+
+        mCapacity = capacity;
+        mSlots.resize(capacity);
+        mWinners.swap(winners);
+        mFailures.assign(capacity, NEVER);
+        mEvents = {};
+        for (size_t node = capacity; node-- > 1;) {
+            play(node);
+        }
+    }
+
+ public:
+    Kinetic_Priority_Queue() {}
+
+    /**
+     * Is this queue empty? Equivalent to .size() == 0
+     */
+    bool empty() const {
+        return mSize == 0;
+    }
+
+    /**
+     * Returns the number of elements stored
+     */
+    int size() const {
+        return mSize;
+    }
+
+    /**
+     * Moves the queue forward to the given time, replaying the matches whose losers have caught up
+     */
+    void advance(int64_t time) {
+        if (time < mNow) {
+            throw std::logic_error("Attempted to move a kinetic priority queue back in time.");
+        }
+        mNow = time;
+
+        while (!mEvents.empty() && mEvents.top().first <= mNow) {
+            Event event = mEvents.top();
+            mEvents.pop();
+            if (mFailures[event.second] == event.first) {
+                replay_up(event.second);
+            }
+        }
+    }
+
+    /**
+     * Retrieve the element with the highest priority at the current time
+     */
+    const T& top() const {
+        if (mSize == 0) {
+            throw std::runtime_error("Attempted to pop from empty queue!");
+        }
+        return mSlots[mWinners[1]].item;
+    }
+
+    /**
+     * Removes the top element
+     */
+    void pop() {
+        size_t slot = mWinners[1];
+        // Resetting the slot lets go of whatever the element owns
+        mSlots[slot].item = T();
+        mFree.push_back(slot);
+        mWinners[mCapacity + slot] = -1;
+        replay_up((mCapacity + slot) / 2);
+        --mSize;
+    }
+
+    /**
+     * Adds an item whose priority is (now - start) / cost. The cost must be greater than zero.
+     */
+    void push(int64_t start, int64_t cost, const T& item) {
+        if (cost <= 0) {
+            throw std::invalid_argument("Kinetic priority queue costs must be greater than zero.");
+        }
+        if (mFree.empty()) {
+            grow();
+        }
+
+        size_t slot = mFree.back();
+        mFree.pop_back();
+        mSlots[slot] = {start, cost, mSequence++, item};
+        mWinners[mCapacity + slot] = slot;
+        replay_up((mCapacity + slot) / 2);
+        ++mSize;
+    }
+};
+
+#endif  // KINETIC_PRIORITY_QUEUE
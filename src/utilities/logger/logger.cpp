@@ -1,5 +1,6 @@
 #include "utilities/logger/logger.hpp"
 
+#include <algorithm>
 #include <cstdio>
 #include <memory>
 #include <sstream>
@@ -13,7 +14,7 @@
 #include "utilities/fmt/format.h"
 
 
-void Logger::print_state_transition(const std::shared_ptr<Event> event, ThreadState before_state, ThreadState after_state) const {
+void Logger::print_state_transition(const Event& event, ThreadState before_state, ThreadState after_state) const {
     /*
     This (along with print_verbose) prints something like this:
 
@@ -23,19 +24,35 @@ void Logger::print_state_transition(const std::shared_ptr<Event> event, ThreadSt
         Transitioned from NEW to READY
     */
 
+    if (!this->verbose) {
+        return;
+    }
+
     std::string message = fmt::format("Transitioned from {} to {}", STATE_MAP[before_state], STATE_MAP[after_state]);
 
-    print_verbose(event, event->thread, message);
+    print_verbose(event, event.thread, message);
+}
+
+
+void Logger::print_scheduling_decision(const Event& event, const SchedulingDecision& decision) const {
+    if (!this->verbose) {
+        return;
+    }
+
+    print_verbose(event, decision.thread, decision.explanation());
 }
 
 
-void Logger::print_verbose(const std::shared_ptr<Event> event, std::shared_ptr<Thread> thread, std::string message) const {
+void Logger::print_verbose(const Event& event, std::shared_ptr<Thread> thread, std::string message) const {
     if (!this->verbose){
         return;
     }
 
-    std::string verbose_message = fmt::format("At time {}:\n", event->time);
-    verbose_message += fmt::format("    {}\n", EVENT_MAP[event->type]);
+    std::string verbose_message = fmt::format("At time {}:\n", event.time);
+    verbose_message += fmt::format("    {}\n", EVENT_MAP[event.type]);
+    if (num_cpus > 1 && event.cpu != -1) {
+        verbose_message += fmt::format("    On CPU {}\n", event.cpu);
+    }
     verbose_message += fmt::format("    Thread {} in process {} [{}]\n", thread->thread_id, thread->process_id, PROCESS_PRIORITY_MAP[thread->priority]);
     verbose_message += fmt::format("    {}\n\n", message);
 
@@ -138,5 +155,69 @@ void Logger::print_simulation_metrics(SystemStats stats) const {
     summary_message += fmt::format("{:<22}{:>11.{}f}%\n", "CPU utilization:", stats.cpu_utilization, 2);
     summary_message += fmt::format("{:<22}{:>11.{}f}%\n", "CPU efficiency:", stats.cpu_efficiency, 2);
 
+    if (stats.deadline_threads > 0) {
+        // Nearest-rank percentiles, taken as the largest value in the rank's histogram bucket
+        auto percentile = [&](int p) {
+            size_t rank = std::max<size_t>((stats.deadline_threads * p + 99) / 100, 1);
+            size_t seen = 0;
+            for (int bucket = 0; bucket < SystemStats::TARDINESS_BUCKETS; ++bucket) {
+                seen += stats.tardiness_histogram[bucket];
+                if (seen >= rank) {
+                    return std::min(SystemStats::tardiness_bucket_max(bucket), stats.max_tardiness);
+                }
+            }
+            return stats.max_tardiness;
+        };
+
+        summary_message += fmt::format("\n{:<22}{:>12}\n", "Deadline threads:", stats.deadline_threads);
+        summary_message += fmt::format("{:<22}{:>12}\n", "Deadline misses:", stats.deadline_misses);
+        summary_message += fmt::format("{:<22}{:>12.{}f}\n", "Avg. tardiness:", stats.total_tardiness / stats.deadline_threads, 2);
+        summary_message += fmt::format("{:<22}{:>12}\n", "Tardiness p50:", percentile(50));
+        summary_message += fmt::format("{:<22}{:>12}\n", "Tardiness p90:", percentile(90));
+        summary_message += fmt::format("{:<22}{:>12}\n", "Tardiness p99:", percentile(99));
+        summary_message += fmt::format("{:<22}{:>12}\n", "Tardiness max:", stats.max_tardiness);
+    }
+
+    if (stats.contended_dispatches > 0) {
+        // What each priority won of the dispatches made while threads competed, and what its tickets entitled it to
+        summary_message += fmt::format("\n{:<22}{:>12}\n", "Contended dispatches:", stats.contended_dispatches);
+        for (int i = SYSTEM; i <= BATCH; ++i) {
+            double won = 100.0 * stats.class_wins[i] / stats.contended_dispatches;
+            double entitled = 100.0 * stats.class_entitlements[i] / stats.contended_dispatches;
+            summary_message += fmt::format("    {:<14} {:>6.{}f}% won, {:>6.{}f}% entitled\n", PROCESS_PRIORITY_MAP[i], won, 2, entitled, 2);
+        }
+    }
+
+    if (stats.dispatches_coalesced > 0) {
+        summary_message += fmt::format("\n{:<22}{:>12}\n", "Dispatches coalesced:", stats.dispatches_coalesced);
+    }
+
+    if (num_cpus > 1) {
+        summary_message += fmt::format("\n{:<22}{:>12}\n", "Migrations:", stats.migrations);
+        summary_message += fmt::format("{:<22}{:>12}\n", "Steals:", stats.steals);
+        summary_message += fmt::format("{:<22}{:>12}\n", "Rebalance moves:", stats.rebalance_moves);
+
+        for (int cpu = 0; cpu < num_cpus; ++cpu) {
+            summary_message += fmt::format("\nCPU {}:\n", cpu);
+            summary_message += fmt::format("    {:<22} {:>8}\n", "Service time:", stats.cpu_service_times[cpu]);
+            summary_message += fmt::format("    {:<22} {:>8}\n", "Dispatch time:", stats.cpu_dispatch_times[cpu]);
+            summary_message += fmt::format("    {:<22} {:>8}\n", "Idle time:", stats.cpu_idle_times[cpu]);
+            summary_message += fmt::format("    {:<22} {:>7.{}f}%\n", "Utilization:", stats.cpu_utilizations[cpu], 2);
+        }
+    }
+
     std::cout << summary_message << std::endl;
 }
+
+void Logger::print_idle_histogram(const SystemStats& stats) const {
+    std::string histogram_message = "IDLE INTERVALS:\n";
+
+    for (size_t bucket = 0; bucket < stats.idle_intervals.size(); ++bucket) {
+        size_t low = size_t(1) << bucket;
+        size_t high = (low << 1) - 1;
+        std::string range = (low == high) ? fmt::format("{}", low) : fmt::format("{}-{}", low, high);
+        histogram_message += fmt::format("    {:<22} {:>8}\n", range + ":", stats.idle_intervals[bucket]);
+    }
+
+    std::cout << histogram_message << std::endl;
+}
@@ -5,6 +5,7 @@
 #include <string>
 #include "types/event/event.hpp"
 #include "types/process/process.hpp"
+#include "types/scheduling_decision/scheduling_decision.hpp"
 #include "types/thread/thread.hpp"
 #include "types/system_stats/system_stats.hpp"
 
@@ -45,6 +46,15 @@ public:
     */
     bool metrics;
 
+    /*
+        num_cpus:
+            The number of simulated CPUs. When there is more than one, verbose output
+            says which CPU each event happened on and the metrics include each CPU.
+
+            Set with the -c, --cpus flag in the command line.
+    */
+    int num_cpus = 1;
+
     //==================================================
     //  Member functions
     //==================================================
@@ -56,10 +66,11 @@ public:
     Logger() {}
 
     /*
-        Logger(verbose, per_thread, metrics):
+        Logger(verbose, per_thread, metrics, num_cpus):
             Constructs a new logger object with the input parameters.
     */
-    Logger(bool verbose, bool per_thread, bool metrics) : verbose(verbose), per_thread(per_thread), metrics(metrics) {}
+    Logger(bool verbose, bool per_thread, bool metrics, int num_cpus = 1) :
+        verbose(verbose), per_thread(per_thread), metrics(metrics), num_cpus(num_cpus) {}
 
     /*
         print_state_transition(event, before_state, after_state):
@@ -67,14 +78,21 @@ public:
             that the thread associated with the given event has transitioned from
             before_state to after_state.
     */
-    void print_state_transition(const std::shared_ptr<Event> event, ThreadState before_state, ThreadState after_state) const;
+    void print_state_transition(const Event& event, ThreadState before_state, ThreadState after_state) const;
+
+    /*
+        print_scheduling_decision(event, decision):
+            If 'verbose' is set to true, outputs the explanation of the scheduling decision
+            made for the given event. The explanation is only formatted if it is printed.
+    */
+    void print_scheduling_decision(const Event& event, const SchedulingDecision& decision) const;
 
     /*
         print_verbose(event, thread, message):
             Outputs the given message if verbose is true. Helper function for
             print_state_transition.
     */
-    void print_verbose(const std::shared_ptr<Event> event, std::shared_ptr<Thread> thread, std::string message) const;
+    void print_verbose(const Event& event, std::shared_ptr<Thread> thread, std::string message) const;
 
     /*
         print_per_thread_metrics(process):
@@ -89,6 +107,13 @@ public:
             contained in a SystemStats object.
     */
     void print_simulation_metrics(SystemStats stats) const;
+
+    /*
+        print_idle_histogram(stats):
+            Outputs how many idle intervals there were of each length. Printed with the
+            -I, --idle_histogram flag.
+    */
+    void print_idle_histogram(const SystemStats& stats) const;
 };
 
 #endif
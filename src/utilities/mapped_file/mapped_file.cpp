@@ -0,0 +1,45 @@
+#include "utilities/mapped_file/mapped_file.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string& filename) {
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd == -1) {
+        throw std::runtime_error("Unable to open " + filename + ": " + std::strerror(errno));
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) == -1) {
+        int error = errno;
+        close(fd);
+        throw std::runtime_error("Unable to read " + filename + ": " + std::strerror(error));
+    }
+
+    length = info.st_size;
+
+    if (length > 0) {
+        void* mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            int error = errno;
+            close(fd);
+            throw std::runtime_error("Unable to map " + filename + ": " + std::strerror(error));
+        }
+        madvise(mapping, length, MADV_SEQUENTIAL);
+        contents = static_cast<const char*>(mapping);
+    }
+
+    // The mapping stays valid after the file is closed
+    close(fd);
+}
+
+MappedFile::~MappedFile() {
+    if (contents) {
+        munmap(const_cast<char*>(contents), length);
+    }
+}
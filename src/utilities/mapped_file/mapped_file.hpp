@@ -0,0 +1,50 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+
+/*
+    MappedFile:
+        A read-only file mapped into memory. The file stays mapped until the object
+        is destroyed, so its contents can be read without copying them.
+*/
+
+class MappedFile {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        MappedFile(filename):
+            Maps the whole file. Throws a std::runtime_error if it cannot be opened or mapped.
+    */
+    MappedFile(const std::string& filename);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /*
+        data() / size():
+            The contents of the file. data() may be nullptr for an empty file.
+    */
+    const char* data() const { return contents; }
+
+    size_t size() const { return length; }
+
+private:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    const char* contents = nullptr;
+
+    size_t length = 0;
+};
+
+#endif
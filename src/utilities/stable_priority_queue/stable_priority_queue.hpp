@@ -5,88 +5,128 @@
  * Why does C++'s STL do this? Because the STL sucks. It's that simple.
  *
  * So props to David Baumann for designing this open source solution so I don't have to.
+ *
+ * The original kept a std::map of std::queues next to a heap of priorities. This version is a
+ * single 4-ary heap ordered by (priority, insertion number), so equal priorities still come out
+ * in FIFO order, but every element lives in one contiguous vector. Use it when priorities span
+ * a wide range, like SPN's burst lengths; for a handful of small priorities,
+ * Bucket_Priority_Queue is faster.
  */
 
 #ifndef STABLE_PRIORITY_QUEUE
 #define STABLE_PRIORITY_QUEUE
 
-#include <queue>
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
 #include <vector>
-#include <map>
-#include <exception>
 
 // Priority Queue that mainains FIFO ordering for elements with the same priority
 // Everything is defined in-line since this is templated.
 template <class T>
 class Stable_Priority_Queue {
  private:
-    std::map<int, std::queue<T>> mQueues;
-    std::priority_queue<int, std::vector<int>, std::greater<int>> mPriorityQueue;
+    // Each node has up to ARITY children. Wider nodes make the heap shallower, and the
+    // children of a node sit next to each other in memory.
+    static const size_t ARITY = 4;
+
+    struct Entry {
+        int priority;
+        uint64_t sequence;
+        T item;
+    };
+
+    std::vector<Entry> mHeap;
+    uint64_t mNextSequence = 0;
+
+    static bool before(const Entry& a, const Entry& b) {
+        return a.priority < b.priority || (a.priority == b.priority && a.sequence < b.sequence);
+    }
+
+    void sift_up(size_t index) {
+        Entry entry = std::move(mHeap[index]);
+        while (index > 0) {
+            size_t parent = (index - 1) / ARITY;
+            if (!before(entry, mHeap[parent])) {
+                break;
+            }
+            mHeap[index] = std::move(mHeap[parent]);
+            index = parent;
+        }
+        mHeap[index] = std::move(entry);
+    }
+
+    void sift_down(size_t index) {
+        Entry entry = std::move(mHeap[index]);
+        size_t count = mHeap.size();
+        while (true) {
+            size_t first = index * ARITY + 1;
+            if (first >= count) {
+                break;
+            }
+            size_t last = std::min(first + ARITY, count);
+            size_t best = first;
+            for (size_t child = first + 1; child < last; ++child) {
+                if (before(mHeap[child], mHeap[best])) {
+                    best = child;
+                }
+            }
+            if (!before(mHeap[best], entry)) {
+                break;
+            }
+            mHeap[index] = std::move(mHeap[best]);
+            index = best;
+        }
+        mHeap[index] = std::move(entry);
+    }
 
  public:
     Stable_Priority_Queue() {}
-        
+
     /**
      * Is this queue empty? Equivalent to .size() == 0
      */
     bool empty() const {
-        return mPriorityQueue.empty();
+        return mHeap.empty();
     }
-        
+
     /**
      * Returns the number of elements stored
      */
     int size() const {
-        return mPriorityQueue.size();
+        return mHeap.size();
     }
 
     /**
      * Retrieve the top element
      */
-    const T& top() {
-        if (mPriorityQueue.empty()) {
+    const T& top() const {
+        if (mHeap.empty()) {
             throw std::runtime_error("Attempted to pop from empty queue!");
         }
-        return mQueues[mPriorityQueue.top()].front();
+        return mHeap.front().item;
     }
-        
+
     /**
      * Removes the top element
      */
     void pop() {
-        mQueues[mPriorityQueue.top()].pop();
-        if (mQueues[mPriorityQueue.top()].empty()) {
-            mQueues.erase(mPriorityQueue.top());
+        if (mHeap.size() > 1) {
+            mHeap.front() = std::move(mHeap.back());
+            mHeap.pop_back();
+            sift_down(0);
+        } else {
+            mHeap.pop_back();
         }
-        mPriorityQueue.pop();
     }
 
     /**
-     * Adds an item into the queue. 
+     * Adds an item into the queue.
      */
     void push(int priority, const T& item) {
-        mPriorityQueue.push(priority);
-        auto theQueue = mQueues.find(priority);
-        if (theQueue == mQueues.end()) {
-            // queue for this priority does not exist yet, so make one
-            mQueues.insert({priority, std::queue<T>()});
-        }
-        mQueues[priority].push(item);
-    }
-
-    /**
-     * Overload for assignment operator for deep-copying
-     */
-    Stable_Priority_Queue<T>& operator=(const Stable_Priority_Queue<T> &other) {
-        // Guard self assignment
-        if (this == &other)
-            return *this;
-        
-        // Use the operator= already defined
-        this->mQueues = other.mQueues;
-        this->mPriorityQueue = other.mPriorityQueue;
-
-        return *this;
+        mHeap.push_back({priority, mNextSequence++, item});
+        sift_up(mHeap.size() - 1);
     }
 };
 
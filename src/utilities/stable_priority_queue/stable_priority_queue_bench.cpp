@@ -0,0 +1,108 @@
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "utilities/benchmark/benchmark.hpp"
+#include "utilities/bucket_priority_queue/bucket_priority_queue.hpp"
+#include "utilities/stable_priority_queue/stable_priority_queue.hpp"
+
+/*
+    Compares the stable priority queues on the pattern schedulers put them through: a ready
+    queue holding a steady number of threads, where every dispatch pops one thread and pushes
+    another back in.
+
+    Map_Priority_Queue is the implementation Stable_Priority_Queue used to have, a std::map of
+    std::queues next to a heap holding a copy of every element's priority, kept here as the
+    baseline.
+*/
+
+namespace {
+
+template <class T>
+class Map_Priority_Queue {
+    std::map<int, std::queue<T>> mQueues;
+    std::priority_queue<int, std::vector<int>, std::greater<int>> mPriorityQueue;
+
+ public:
+    bool empty() const {
+        return mPriorityQueue.empty();
+    }
+
+    const T& top() {
+        return mQueues[mPriorityQueue.top()].front();
+    }
+
+    void pop() {
+        mQueues[mPriorityQueue.top()].pop();
+        if (mQueues[mPriorityQueue.top()].empty()) {
+            mQueues.erase(mPriorityQueue.top());
+        }
+        mPriorityQueue.pop();
+    }
+
+    void push(int priority, const T& item) {
+        mQueues[priority].push(item);
+        mPriorityQueue.push(priority);
+    }
+};
+
+using Item = std::shared_ptr<int>;
+
+const int QUEUED = 1000;
+const int OPERATIONS = 1000000;
+
+// Fills the queue, then pops and pushes OPERATIONS times with priorities from 0 to range - 1
+template <class Queue>
+double time_queue(int range) {
+    std::vector<Item> items;
+    for (int index = 0; index < QUEUED; ++index) {
+        items.push_back(std::make_shared<int>(index));
+    }
+
+    int64_t total = 0;
+    double seconds = time_best_of(5, [&] {
+        Queue queue;
+        uint32_t state = 12345;
+        auto next_priority = [&] {
+            state = state * 1103515245 + 12345;
+            return int((state >> 8) % range);
+        };
+
+        for (const Item& item : items) {
+            queue.push(next_priority(), item);
+        }
+        for (int operation = 0; operation < OPERATIONS; ++operation) {
+            Item item = queue.top();
+            queue.pop();
+            total += *item;
+            queue.push(next_priority(), item);
+        }
+        while (!queue.empty()) {
+            queue.pop();
+        }
+    });
+
+    // Using the result keeps the loop from being optimized away
+    if (total <= 0) {
+        throw std::logic_error("The queue returned no items.");
+    }
+
+    return seconds;
+}
+
+}
+
+BENCHMARK(stable_priority_queue) {
+    report("4 priorities, map of queues", time_queue<Map_Priority_Queue<Item>>(4), OPERATIONS, "ops");
+    report("4 priorities, 4-ary heap", time_queue<Stable_Priority_Queue<Item>>(4), OPERATIONS, "ops");
+    report("4 priorities, bucket queue", time_queue<Bucket_Priority_Queue<Item, 4>>(4), OPERATIONS, "ops");
+
+    // Roughly the spread of burst lengths SPN sorts by
+    report("500 priorities, map of queues", time_queue<Map_Priority_Queue<Item>>(500), OPERATIONS, "ops");
+    report("500 priorities, 4-ary heap", time_queue<Stable_Priority_Queue<Item>>(500), OPERATIONS, "ops");
+}
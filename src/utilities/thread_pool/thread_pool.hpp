@@ -0,0 +1,80 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+/*
+    ThreadPool:
+        A fixed number of worker threads that run submitted tasks in the order
+        they were submitted.
+*/
+
+class ThreadPool {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        ThreadPool(num_threads):
+            Starts num_threads worker threads (at least one).
+    */
+    ThreadPool(size_t num_threads);
+
+    /*
+        ~ThreadPool():
+            Waits for every submitted task to finish, then stops the workers.
+    */
+    ~ThreadPool();
+
+    /*
+        submit(task):
+            Queues a task to run on one of the workers. Tasks must not throw.
+    */
+    void submit(std::function<void()> task);
+
+    /*
+        wait():
+            Blocks until every submitted task has finished.
+    */
+    void wait();
+
+private:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    std::vector<std::thread> workers;
+
+    std::queue<std::function<void()>> tasks;
+
+    /*
+        unfinished:
+            The number of tasks that were submitted but have not finished yet.
+    */
+    size_t unfinished = 0;
+
+    bool stopping = false;
+
+    std::mutex mutex;
+
+    std::condition_variable task_available;
+
+    std::condition_variable all_finished;
+
+    /*
+        work():
+            The loop each worker runs, taking tasks until the pool is stopped.
+    */
+    void work();
+};
+
+#endif
@@ -0,0 +1,171 @@
+#include "utilities/trace_parser/trace_parser.hpp"
+
+#include <climits>
+#include <stdexcept>
+#include <utility>
+
+#include "utilities/mapped_file/mapped_file.hpp"
+
+TraceParser::TraceParser(const char* begin, const char* end, const std::string& source) :
+    begin(begin), position(begin), end(end), token(begin), source(source) {}
+
+Workload TraceParser::read_workload() {
+    Workload workload;
+
+    int num_processes = read_int("the number of processes");
+    if (num_processes < 0) {
+        fail("the number of processes cannot be negative");
+    }
+
+    workload.thread_switch_overhead = read_int("the thread switch overhead");
+    workload.process_switch_overhead = read_int("the process switch overhead");
+    if (workload.thread_switch_overhead < 0 || workload.process_switch_overhead < 0) {
+        fail("switch overheads cannot be negative");
+    }
+
+    workload.processes.reserve(num_processes);
+    for (int proc = 0; proc < num_processes; ++proc) {
+        workload.processes.push_back(read_process());
+    }
+
+    workload.attach_bursts(std::move(burst_table));
+    return workload;
+}
+
+std::shared_ptr<Process> TraceParser::read_process() {
+    int process_id = read_int("a process ID");
+    int priority = read_int("a process priority");
+    if (priority < SYSTEM || priority > BATCH) {
+        fail("process priorities must be between 0 and 3");
+    }
+    int num_threads = read_int("the number of threads");
+    if (num_threads < 0) {
+        fail("the number of threads cannot be negative");
+    }
+
+    auto process = std::make_shared<Process>(process_id, (ProcessPriority)priority);
+
+    // An optional number of tickets can follow on the same line
+    if (!at_line_end()) {
+        process->tickets = read_int("a number of tickets");
+        if (process->tickets <= 0) {
+            fail("tickets must be positive");
+        }
+    }
+
+    process->threads.reserve(num_threads);
+    for (int thread_id = 0; thread_id < num_threads; ++thread_id) {
+        process->threads.push_back(read_thread(thread_id, process_id, (ProcessPriority)priority));
+        process->threads.back()->tickets = process->tickets;
+    }
+
+    return process;
+}
+
+std::shared_ptr<Thread> TraceParser::read_thread(int thread_id, int process_id, ProcessPriority priority) {
+    int arrival_time = read_int("an arrival time");
+    if (arrival_time < 0) {
+        fail("arrival times cannot be negative");
+    }
+    int num_cpu_bursts = read_int("the number of CPU bursts");
+    if (num_cpu_bursts <= 0) {
+        fail("a thread must have at least one CPU burst");
+    }
+
+    auto thread = std::make_shared<Thread>(arrival_time, thread_id, process_id, priority);
+
+    // An optional deadline, and then an optional period, can follow on the same line
+    if (!at_line_end()) {
+        thread->relative_deadline = read_int("a deadline");
+        if (thread->relative_deadline <= 0) {
+            fail("deadlines must be positive");
+        }
+        if (!at_line_end()) {
+            thread->period = read_int("a period");
+            if (thread->period <= 0) {
+                fail("periods must be positive");
+            }
+        }
+    }
+
+    thread->num_bursts = num_cpu_bursts * 2 - 1;
+    for (uint32_t n = 0; n < thread->num_bursts; ++n) {
+        int burst_length = read_int("a burst length");
+        if (burst_length <= 0) {
+            fail("burst lengths must be positive");
+        }
+
+        burst_table.push_back(burst_length);
+    }
+
+    return thread;
+}
+
+void TraceParser::skip_whitespace() {
+    while (position != end && (*position == ' ' || *position == '\t' || *position == '\r' || *position == '\n')) {
+        if (*position == '\n') {
+            line++;
+        }
+        position++;
+    }
+}
+
+bool TraceParser::at_line_end() {
+    while (position != end && (*position == ' ' || *position == '\t' || *position == '\r')) {
+        position++;
+    }
+    return position == end || *position == '\n';
+}
+
+bool TraceParser::at_end() {
+    skip_whitespace();
+    return position == end;
+}
+
+int TraceParser::read_int(const char* what) {
+    skip_whitespace();
+
+    if (position == end) {
+        token = position;
+        fail(std::string("expected ") + what + " but reached the end of the file");
+    }
+
+    const char* start = position;
+    token = start;
+    bool negative = false;
+    if (*position == '-' || *position == '+') {
+        negative = (*position == '-');
+        position++;
+    }
+
+    long long value = 0;
+    const char* digits = position;
+    while (position != end && *position >= '0' && *position <= '9') {
+        value = value * 10 + (*position - '0');
+        if (value > INT_MAX) {
+            fail(std::string("expected ") + what + " but the number is too large");
+        }
+        position++;
+    }
+
+    // The number has to be followed by whitespace (or the end of the file)
+    if (position == digits || (position != end && *position != ' ' && *position != '\t' && *position != '\r' && *position != '\n')) {
+        const char* token_end = start;
+        while (token_end != end && token_end - start < 20 && *token_end != ' ' && *token_end != '\t' && *token_end != '\r' && *token_end != '\n') {
+            token_end++;
+        }
+        fail(std::string("expected ") + what + " but found \"" + std::string(start, token_end) + "\"");
+    }
+
+    return negative ? -value : value;
+}
+
+void TraceParser::fail(const std::string& message) const {
+    throw std::runtime_error(source + ":" + std::to_string(line) + " (byte " + std::to_string(token - begin) + "): " + message);
+}
+
+Workload read_trace_file(const std::string& filename) {
+    MappedFile file(filename);
+    TraceParser parser(file.data(), file.data() + file.size(), filename);
+    return parser.read_workload();
+}
@@ -0,0 +1,128 @@
+#ifndef TRACE_PARSER_HPP
+#define TRACE_PARSER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types/enums.hpp"
+#include "types/process/process.hpp"
+#include "types/thread/thread.hpp"
+#include "types/workload/workload.hpp"
+
+/*
+    TraceParser:
+        Parses a simulation file that is already in memory (usually a MappedFile), scanning
+        the integers directly instead of going through a locale-aware std::istream.
+
+        A process's line may end with an optional number of tickets, like "0 1 2 500".
+        A thread's line may carry two optional columns after its number of CPU bursts: a
+        deadline (relative to its arrival time) and then a period, like "0 3 40 50".
+
+        It checks the file as it goes. Errors are thrown as a
+        std::runtime_error naming the line and byte offset of the problem, like:
+            tests/input/input-1:4 (byte 17): expected a burst length but found "x"
+*/
+
+class TraceParser {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        TraceParser(begin, end, source):
+            Creates a parser over the characters in [begin, end). The source (usually the
+            filename) is only used in error messages.
+    */
+    TraceParser(const char* begin, const char* end, const std::string& source);
+
+    /*
+        read_workload():
+            Parses the whole simulation file.
+    */
+    Workload read_workload();
+
+    /*
+        read_int(what):
+            Skips whitespace and parses the next integer. what describes the expected value
+            for the error message if there is no integer there.
+    */
+    int read_int(const char* what);
+
+    /*
+        at_end():
+            Skips whitespace and returns true if there is nothing left to parse.
+    */
+    bool at_end();
+
+    /*
+        at_line_end():
+            Skips spaces and returns true if there is nothing else on the current line.
+    */
+    bool at_line_end();
+
+    /*
+        fail(message):
+            Throws a std::runtime_error for the most recent token.
+    */
+    [[noreturn]] void fail(const std::string& message) const;
+
+private:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    const char* begin;
+
+    const char* position;
+
+    const char* end;
+
+    /*
+        token:
+            Where the integer last returned by read_int started, which is where
+            errors are reported.
+    */
+    const char* token;
+
+    /*
+        line:
+            The line that position is on, counting from 1.
+    */
+    size_t line = 1;
+
+    std::string source;
+
+    /*
+        burst_table:
+            Every burst read so far, back to back. Handed to the workload once it has been read.
+    */
+    std::vector<int32_t> burst_table;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        skip_whitespace():
+            Moves position past any whitespace, counting lines as it goes.
+    */
+    void skip_whitespace();
+
+    std::shared_ptr<Process> read_process();
+
+    std::shared_ptr<Thread> read_thread(int thread_id, int process_id, ProcessPriority priority);
+};
+
+/*
+    read_trace_file(filename):
+        Maps the simulation file into memory and parses it with a TraceParser.
+*/
+Workload read_trace_file(const std::string& filename);
+
+#endif
@@ -0,0 +1,104 @@
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "simulation/simulation.hpp"
+#include "utilities/benchmark/benchmark.hpp"
+#include "utilities/mapped_file/mapped_file.hpp"
+#include "utilities/trace_parser/trace_parser.hpp"
+
+/*
+    Compares reading a generated simulation file with a std::istream reader, like the one
+    the simulation used before TraceParser, and with the memory-mapped TraceParser.
+*/
+
+namespace {
+
+// Reads a simulation file the way the original reader did, without checking it for errors
+Workload read_stream(std::istream& input) {
+    Workload workload;
+    int num_processes;
+    input >> num_processes >> workload.thread_switch_overhead >> workload.process_switch_overhead;
+
+    std::vector<int32_t> burst_table;
+    for (int proc = 0; proc < num_processes; ++proc) {
+        int process_id, priority, num_threads;
+        input >> process_id >> priority >> num_threads;
+
+        auto process = std::make_shared<Process>(process_id, (ProcessPriority)priority);
+        for (int thread_id = 0; thread_id < num_threads; ++thread_id) {
+            int arrival_time, num_cpu_bursts;
+            input >> arrival_time >> num_cpu_bursts;
+
+            auto thread = std::make_shared<Thread>(arrival_time, thread_id, process_id, (ProcessPriority)priority);
+            thread->num_bursts = num_cpu_bursts * 2 - 1;
+            for (uint32_t n = 0, burst_length; n < thread->num_bursts; ++n) {
+                input >> burst_length;
+                burst_table.push_back(burst_length);
+            }
+            process->threads.push_back(thread);
+        }
+        workload.processes.push_back(process);
+    }
+
+    workload.attach_bursts(std::move(burst_table));
+    return workload;
+}
+
+size_t count_bursts(const Workload& workload) {
+    size_t bursts = 0;
+    for (const auto& process : workload.processes) {
+        for (const auto& thread : process->threads) {
+            bursts += thread->num_bursts;
+        }
+    }
+    return bursts;
+}
+
+}
+
+BENCHMARK(trace_parser_read_file) {
+    char filename[] = "/tmp/cpu-sim-bench-XXXXXX";
+    int fd = mkstemp(filename);
+    if (fd == -1) {
+        throw std::runtime_error("Unable to create a temporary file.");
+    }
+    close(fd);
+
+    size_t bytes = write_random_trace(filename, 100, 100, 200);
+    size_t expected = 0;
+
+    double stream_seconds = time_best_of(3, [&] {
+        std::ifstream input(filename);
+        expected = count_bursts(read_stream(input));
+    });
+
+    size_t parsed = 0;
+    double mapped_seconds = time_best_of(3, [&] {
+        parsed = count_bursts(read_trace_file(filename));
+    });
+
+    // Just scanning the integers, without building the threads and bursts
+    double scan_seconds = time_best_of(3, [&] {
+        MappedFile file(filename);
+        TraceParser parser(file.data(), file.data() + file.size(), filename);
+        while (!parser.at_end()) {
+            parser.read_int("a number");
+        }
+    });
+
+    std::remove(filename);
+
+    if (parsed != expected) {
+        throw std::runtime_error("The readers disagree on the number of bursts.");
+    }
+
+    report("std::istream (" + std::to_string(bytes >> 20) + " MiB)", stream_seconds, bytes, "bytes");
+    report("mapped TraceParser", mapped_seconds, bytes, "bytes");
+    report("mapped TraceParser, integers only", scan_seconds, bytes, "bytes");
+}
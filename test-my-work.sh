@@ -1,7 +1,5 @@
 #!/bin/bash
-#Switch these for loops (commented and uncommented) to enable CFS testing
-#for alg in fcfs spn rr rr-s6 priority mlfq cfs cfs-s6
-for alg in fcfs spn rr rr-s6 priority mlfq
+for alg in fcfs spn srt srt-oracle hrrn hrrn-oracle rr rr-s6 priority mlfq cfs cfs-s6 lottery stride
 do
 	for i in 1 2 3 4 5
 	do
@@ -10,8 +8,7 @@ do
 
 		alg_param="-a ${alg^^}"
 		alg_param=${alg_param/"RR-S6"/"RR -s 6"}
-		#Uncomment the statement below to enable CFS testing
-    #alg_param=${alg_param/"CFS-S6"/"CFS -s 6"}
+		alg_param=${alg_param/"CFS-S6"/"CFS -s 6"}
 
 		for mode_param in v t m
 		do
@@ -31,3 +28,105 @@ do
 	done
 done
 
+
+# Deadline scheduling, on an input where threads preempt others with later deadlines (or longer
+# periods) and miss their own deadlines.
+for alg in edf rm
+do
+	inputfilename=tests/input/input-deadline
+	outputfilename=tests/output/output-$alg-deadline
+
+	for mode_param in v t m
+	do
+		SIM_COMMAND="./cpu-sim -$mode_param -a ${alg^^} $inputfilename"
+		echo Executing $SIM_COMMAND
+		$SIM_COMMAND &> my_output
+		DIFF=$(diff -b -B my_output $outputfilename.$mode_param)
+		if [ "$DIFF" != "" ]
+		then
+			diff -b -B my_output $outputfilename.$mode_param > my_output.diff
+			echo "   The output does not match $outputfilename.$mode_param Please check my_output and my_output.diff for details."
+			exit
+		else
+			echo -e "\e[32mTest passed!\e[0m"
+		fi
+	done
+done
+
+# With per-CPU run queues and periodic rebalancing only, a thread moved to an idle CPU's run queue
+# must still be dispatched, so every thread has to reach EXIT.
+for alg in fcfs rr mlfq lottery stride
+do
+	for i in 1 2 3 4 5
+	do
+		inputfilename=tests/input/input-$i
+
+		SIM_COMMAND="./cpu-sim -t -a ${alg^^} -c 3 -p -b periodic -i 5 $inputfilename"
+		echo Executing $SIM_COMMAND
+		$SIM_COMMAND &> my_output
+		THREADS=$(grep -c "ARR:" my_output)
+		EXITED=$(./cpu-sim -v -a ${alg^^} -c 3 -p -b periodic -i 5 $inputfilename | grep -c "to EXIT")
+		if grep -q "END: -1" my_output || [ "$THREADS" != "$EXITED" ]
+		then
+			echo "   Only $EXITED of $THREADS threads finished. Please check my_output for details."
+			exit
+		else
+			echo -e "\e[32mTest passed!\e[0m"
+		fi
+	done
+done
+
+# Stride scheduling must split the CPU 2:1 between two CPU-bound threads holding 1 and 2 shares of
+# the tickets, so the one with more tickets finishes its 300 ticks at 450 and the other at 600.
+for size in small large
+do
+	inputfilename=tests/input/input-tickets-$size
+
+	SIM_COMMAND="./cpu-sim -t -a STRIDE $inputfilename"
+	echo Executing $SIM_COMMAND
+	$SIM_COMMAND &> my_output
+	ENDS=$(grep -o "END: [0-9]*" my_output | tr -d '\n')
+	if [ "$ENDS" != "END: 600END: 450" ]
+	then
+		echo "   The threads did not split the CPU 2:1 by their tickets. Please check my_output for details."
+		exit
+	else
+		echo -e "\e[32mTest passed!\e[0m"
+	fi
+done
+
+# Save checkpoints as the simulation runs, then restore the last one in a new run, which must
+# finish with the same output as a run that was never interrupted.
+for alg in fcfs spn rr priority mlfq
+do
+	for i in 1 2 3 4 5
+	do
+		inputfilename=tests/input/input-$i
+		outputfilename=tests/output/output-$alg-$i
+
+		alg_param="-a ${alg^^}"
+
+		for every in 25 200t
+		do
+			rm -f my_checkpoint
+			./cpu-sim -k $every -K my_checkpoint $alg_param $inputfilename &> /dev/null
+
+			for mode_param in t m
+			do
+				SIM_COMMAND="./cpu-sim -$mode_param -r my_checkpoint $alg_param $inputfilename"
+				echo Executing $SIM_COMMAND "(checkpointed every $every)"
+				$SIM_COMMAND &> my_output
+				DIFF=$(diff -b -B my_output $outputfilename.$mode_param)
+				if [ "$DIFF" != "" ]
+				then
+					diff -b -B my_output $outputfilename.$mode_param > my_output.diff
+					echo "   The output does not match $outputfilename.$mode_param Please check my_output and my_output.diff for details."
+					exit
+				else
+					echo -e "\e[32mTest passed!\e[0m"
+				fi
+			done
+		done
+	done
+done
+rm -f my_checkpoint
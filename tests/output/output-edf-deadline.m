@@ -0,0 +1,39 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  2
+    Avg. response time:        7.50
+    Avg. turnaround time:     45.00
+
+NORMAL THREADS:
+    Total Count:                  2
+    Avg. response time:        1.50
+    Avg. turnaround time:    126.50
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:            146
+Total service time:            135
+Total I/O time:                  5
+Total dispatch time:            11
+Total idle time:                 0
+
+CPU utilization:           100.00%
+CPU efficiency:             92.47%
+
+Deadline threads:                4
+Deadline misses:                 3
+Avg. tardiness:              28.00
+Tardiness p50:                   2
+Tardiness p90:                  63
+Tardiness p99:                  63
+Tardiness max:                  63
+
@@ -0,0 +1,10 @@
+SIMULATION COMPLETED!
+
+Process 0 [NORMAL]:
+    Thread  0:    ARR: 0      CPU: 40     I/O: 0      TRT: 146    END: 146   
+    Thread  1:    ARR: 10     CPU: 20     I/O: 5      TRT: 107    END: 117   
+
+Process 1 [INTERACTIVE]:
+    Thread  0:    ARR: 15     CPU: 15     I/O: 0      TRT: 17     END: 32    
+    Thread  1:    ARR: 20     CPU: 60     I/O: 0      TRT: 73     END: 93    
+
@@ -0,0 +1,147 @@
+At time 0:
+    THREAD_ARRIVED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 0:
+    DISPATCHER_INVOKED
+    Thread 0 in process 0 [NORMAL]
+    Selected from 1 threads (deadline = 200). Will run to completion of burst.
+
+At time 2:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10:
+    THREAD_ARRIVED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 10:
+    THREAD_PREEMPTED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10:
+    DISPATCHER_INVOKED
+    Thread 1 in process 0 [NORMAL]
+    Selected from 2 threads (deadline = 70). Will run to completion of burst.
+
+At time 11:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15:
+    THREAD_ARRIVED
+    Thread 0 in process 1 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 15:
+    THREAD_PREEMPTED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15:
+    DISPATCHER_INVOKED
+    Thread 0 in process 1 [INTERACTIVE]
+    Selected from 3 threads (deadline = 30). Will run to completion of burst.
+
+At time 17:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 1 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 20:
+    THREAD_ARRIVED
+    Thread 1 in process 1 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 32:
+    THREAD_COMPLETED
+    Thread 0 in process 1 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 32:
+    DISPATCHER_INVOKED
+    Thread 1 in process 1 [INTERACTIVE]
+    Selected from 3 threads (deadline = 30). Will run to completion of burst.
+
+At time 33:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 1 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 93:
+    THREAD_COMPLETED
+    Thread 1 in process 1 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 93:
+    DISPATCHER_INVOKED
+    Thread 1 in process 0 [NORMAL]
+    Selected from 2 threads (deadline = 70). Will run to completion of burst.
+
+At time 95:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 101:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 101:
+    DISPATCHER_INVOKED
+    Thread 0 in process 0 [NORMAL]
+    Selected from 1 threads (deadline = 200). Will run to completion of burst.
+
+At time 102:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 106:
+    IO_BURST_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 106:
+    THREAD_PREEMPTED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 106:
+    DISPATCHER_INVOKED
+    Thread 1 in process 0 [NORMAL]
+    Selected from 2 threads (deadline = 70). Will run to completion of burst.
+
+At time 107:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 117:
+    THREAD_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 117:
+    DISPATCHER_INVOKED
+    Thread 0 in process 0 [NORMAL]
+    Selected from 1 threads (deadline = 200). Will run to completion of burst.
+
+At time 118:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 146:
+    THREAD_COMPLETED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
@@ -0,0 +1,27 @@
+SIMULATION COMPLETED!
+
+Process 203 [NORMAL]:
+    Thread  0:    ARR: 48     CPU: 135    I/O: 115    TRT: 4061   END: 4109  
+
+Process 297 [BATCH]:
+    Thread  0:    ARR: 10     CPU: 71     I/O: 44     TRT: 1759   END: 1769  
+
+Process 341 [INTERACTIVE]:
+    Thread  0:    ARR: 82     CPU: 121    I/O: 58     TRT: 3893   END: 3975  
+
+Process 395 [NORMAL]:
+    Thread  0:    ARR: 58     CPU: 2      I/O: 0      TRT: 482    END: 540   
+    Thread  1:    ARR: 28     CPU: 105    I/O: 119    TRT: 3533   END: 3561  
+    Thread  2:    ARR: 33     CPU: 70     I/O: 28     TRT: 2184   END: 2217  
+
+Process 404 [BATCH]:
+    Thread  0:    ARR: 0      CPU: 182    I/O: 153    TRT: 4232   END: 4232  
+    Thread  1:    ARR: 53     CPU: 96     I/O: 81     TRT: 3251   END: 3304  
+    Thread  2:    ARR: 58     CPU: 26     I/O: 39     TRT: 1482   END: 1540  
+
+Process 613 [NORMAL]:
+    Thread  0:    ARR: 70     CPU: 74     I/O: 84     TRT: 3134   END: 3204  
+    Thread  1:    ARR: 47     CPU: 119    I/O: 102    TRT: 3855   END: 3902  
+    Thread  2:    ARR: 39     CPU: 14     I/O: 0      TRT: 268    END: 307   
+    Thread  3:    ARR: 87     CPU: 112    I/O: 68     TRT: 3594   END: 3681  
+
@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                 13
+    Avg. response time:      682.31
+    Avg. turnaround time:   5830.38
+
+INTERACTIVE THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+NORMAL THREADS:
+    Total Count:                 10
+    Avg. response time:      786.70
+    Avg. turnaround time:   6468.50
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           8319
+Total service time:           2134
+Total I/O time:               1835
+Total dispatch time:          6171
+Total idle time:                14
+
+CPU utilization:            99.83%
+CPU efficiency:             25.65%
+
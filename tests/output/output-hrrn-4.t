@@ -0,0 +1,41 @@
+SIMULATION COMPLETED!
+
+Process 71 [SYSTEM]:
+    Thread  0:    ARR: 59     CPU: 99     I/O: 89     TRT: 7036   END: 7095  
+
+Process 104 [SYSTEM]:
+    Thread  0:    ARR: 79     CPU: 57     I/O: 74     TRT: 5147   END: 5226  
+    Thread  1:    ARR: 50     CPU: 239    I/O: 142    TRT: 8269   END: 8319  
+    Thread  2:    ARR: 22     CPU: 64     I/O: 12     TRT: 4670   END: 4692  
+    Thread  3:    ARR: 50     CPU: 89     I/O: 97     TRT: 6413   END: 6463  
+
+Process 242 [NORMAL]:
+    Thread  0:    ARR: 59     CPU: 89     I/O: 84     TRT: 6967   END: 7026  
+    Thread  1:    ARR: 71     CPU: 132    I/O: 126    TRT: 7937   END: 8008  
+    Thread  2:    ARR: 39     CPU: 87     I/O: 88     TRT: 6251   END: 6290  
+
+Process 320 [NORMAL]:
+    Thread  0:    ARR: 23     CPU: 73     I/O: 56     TRT: 5505   END: 5528  
+    Thread  1:    ARR: 92     CPU: 124    I/O: 91     TRT: 7626   END: 7718  
+    Thread  2:    ARR: 71     CPU: 79     I/O: 40     TRT: 5974   END: 6045  
+
+Process 428 [SYSTEM]:
+    Thread  0:    ARR: 25     CPU: 63     I/O: 120    TRT: 6066   END: 6091  
+    Thread  1:    ARR: 95     CPU: 149    I/O: 104    TRT: 8094   END: 8189  
+
+Process 461 [SYSTEM]:
+    Thread  0:    ARR: 44     CPU: 126    I/O: 119    TRT: 7916   END: 7960  
+    Thread  1:    ARR: 67     CPU: 63     I/O: 81     TRT: 5700   END: 5767  
+    Thread  2:    ARR: 47     CPU: 43     I/O: 54     TRT: 2569   END: 2616  
+
+Process 687 [NORMAL]:
+    Thread  0:    ARR: 45     CPU: 80     I/O: 76     TRT: 6182   END: 6227  
+    Thread  1:    ARR: 59     CPU: 57     I/O: 53     TRT: 3628   END: 3687  
+    Thread  2:    ARR: 76     CPU: 74     I/O: 100    TRT: 6552   END: 6628  
+    Thread  3:    ARR: 10     CPU: 147    I/O: 112    TRT: 8063   END: 8073  
+
+Process 729 [SYSTEM]:
+    Thread  0:    ARR: 17     CPU: 37     I/O: 10     TRT: 1713   END: 1730  
+    Thread  1:    ARR: 49     CPU: 87     I/O: 45     TRT: 7163   END: 7212  
+    Thread  2:    ARR: 55     CPU: 76     I/O: 62     TRT: 5039   END: 5094  
+
@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  3
+    Avg. response time:       99.67
+    Avg. turnaround time:   1333.33
+
+NORMAL THREADS:
+    Total Count:                  4
+    Avg. response time:      160.75
+    Avg. turnaround time:    723.25
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           1578
+Total service time:            628
+Total I/O time:                517
+Total dispatch time:           905
+Total idle time:                45
+
+CPU utilization:            97.15%
+CPU efficiency:             39.80%
+
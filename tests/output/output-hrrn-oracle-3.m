@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:      399.00
+    Avg. turnaround time:   3591.00
+
+NORMAL THREADS:
+    Total Count:                  8
+    Avg. response time:      475.75
+    Avg. turnaround time:   2522.50
+
+BATCH THREADS:
+    Total Count:                  4
+    Avg. response time:      221.75
+    Avg. turnaround time:   2669.75
+
+Total elapsed time:           4126
+Total service time:           1127
+Total I/O time:                891
+Total dispatch time:          2964
+Total idle time:                35
+
+CPU utilization:            99.15%
+CPU efficiency:             27.31%
+
@@ -0,0 +1,27 @@
+SIMULATION COMPLETED!
+
+Process 203 [NORMAL]:
+    Thread  0:    ARR: 48     CPU: 135    I/O: 115    TRT: 3840   END: 3888  
+
+Process 297 [BATCH]:
+    Thread  0:    ARR: 10     CPU: 71     I/O: 44     TRT: 2276   END: 2286  
+
+Process 341 [INTERACTIVE]:
+    Thread  0:    ARR: 82     CPU: 121    I/O: 58     TRT: 3591   END: 3673  
+
+Process 395 [NORMAL]:
+    Thread  0:    ARR: 58     CPU: 2      I/O: 0      TRT: 84     END: 142   
+    Thread  1:    ARR: 28     CPU: 105    I/O: 119    TRT: 3368   END: 3396  
+    Thread  2:    ARR: 33     CPU: 70     I/O: 28     TRT: 2189   END: 2222  
+
+Process 404 [BATCH]:
+    Thread  0:    ARR: 0      CPU: 182    I/O: 153    TRT: 4126   END: 4126  
+    Thread  1:    ARR: 53     CPU: 96     I/O: 81     TRT: 3547   END: 3600  
+    Thread  2:    ARR: 58     CPU: 26     I/O: 39     TRT: 730    END: 788   
+
+Process 613 [NORMAL]:
+    Thread  0:    ARR: 70     CPU: 74     I/O: 84     TRT: 2772   END: 2842  
+    Thread  1:    ARR: 47     CPU: 119    I/O: 102    TRT: 3772   END: 3819  
+    Thread  2:    ARR: 39     CPU: 14     I/O: 0      TRT: 285    END: 324   
+    Thread  3:    ARR: 87     CPU: 112    I/O: 68     TRT: 3870   END: 3957  
+
@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                 13
+    Avg. response time:      880.15
+    Avg. turnaround time:   5673.08
+
+INTERACTIVE THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+NORMAL THREADS:
+    Total Count:                 10
+    Avg. response time:      685.20
+    Avg. turnaround time:   6348.30
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           8118
+Total service time:           2134
+Total I/O time:               1835
+Total dispatch time:          5919
+Total idle time:                65
+
+CPU utilization:            99.20%
+CPU efficiency:             26.29%
+
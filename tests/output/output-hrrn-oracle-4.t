@@ -0,0 +1,41 @@
+SIMULATION COMPLETED!
+
+Process 71 [SYSTEM]:
+    Thread  0:    ARR: 59     CPU: 99     I/O: 89     TRT: 6741   END: 6800  
+
+Process 104 [SYSTEM]:
+    Thread  0:    ARR: 79     CPU: 57     I/O: 74     TRT: 4456   END: 4535  
+    Thread  1:    ARR: 50     CPU: 239    I/O: 142    TRT: 8068   END: 8118  
+    Thread  2:    ARR: 22     CPU: 64     I/O: 12     TRT: 4550   END: 4572  
+    Thread  3:    ARR: 50     CPU: 89     I/O: 97     TRT: 6436   END: 6486  
+
+Process 242 [NORMAL]:
+    Thread  0:    ARR: 59     CPU: 89     I/O: 84     TRT: 6491   END: 6550  
+    Thread  1:    ARR: 71     CPU: 132    I/O: 126    TRT: 7522   END: 7593  
+    Thread  2:    ARR: 39     CPU: 87     I/O: 88     TRT: 6315   END: 6354  
+
+Process 320 [NORMAL]:
+    Thread  0:    ARR: 23     CPU: 73     I/O: 56     TRT: 5539   END: 5562  
+    Thread  1:    ARR: 92     CPU: 124    I/O: 91     TRT: 7453   END: 7545  
+    Thread  2:    ARR: 71     CPU: 79     I/O: 40     TRT: 6032   END: 6103  
+
+Process 428 [SYSTEM]:
+    Thread  0:    ARR: 25     CPU: 63     I/O: 120    TRT: 5004   END: 5029  
+    Thread  1:    ARR: 95     CPU: 149    I/O: 104    TRT: 7747   END: 7842  
+
+Process 461 [SYSTEM]:
+    Thread  0:    ARR: 44     CPU: 126    I/O: 119    TRT: 7432   END: 7476  
+    Thread  1:    ARR: 67     CPU: 63     I/O: 81     TRT: 5011   END: 5078  
+    Thread  2:    ARR: 47     CPU: 43     I/O: 54     TRT: 3165   END: 3212  
+
+Process 687 [NORMAL]:
+    Thread  0:    ARR: 45     CPU: 80     I/O: 76     TRT: 6192   END: 6237  
+    Thread  1:    ARR: 59     CPU: 57     I/O: 53     TRT: 4184   END: 4243  
+    Thread  2:    ARR: 76     CPU: 74     I/O: 100    TRT: 5969   END: 6045  
+    Thread  3:    ARR: 10     CPU: 147    I/O: 112    TRT: 7786   END: 7796  
+
+Process 729 [SYSTEM]:
+    Thread  0:    ARR: 17     CPU: 37     I/O: 10     TRT: 2958   END: 2975  
+    Thread  1:    ARR: 49     CPU: 87     I/O: 45     TRT: 6551   END: 6600  
+    Thread  2:    ARR: 55     CPU: 76     I/O: 62     TRT: 5631   END: 5686  
+
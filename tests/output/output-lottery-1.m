@@ -0,0 +1,37 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  3
+    Avg. response time:       60.67
+    Avg. turnaround time:   3754.67
+
+NORMAL THREADS:
+    Total Count:                  4
+    Avg. response time:      268.25
+    Avg. turnaround time:   2753.50
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           4936
+Total service time:            628
+Total I/O time:                517
+Total dispatch time:          4244
+Total idle time:                64
+
+CPU utilization:            98.70%
+CPU efficiency:             12.72%
+
+Contended dispatches:          206
+    SYSTEM           0.00% won,   0.00% entitled
+    INTERACTIVE     66.02% won,  67.77% entitled
+    NORMAL          33.98% won,  32.23% entitled
+    BATCH            0.00% won,   0.00% entitled
+
@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+Process 642 [INTERACTIVE]:
+    Thread  0:    ARR: 50     CPU: 104    I/O: 86     TRT: 3102   END: 3152  
+    Thread  1:    ARR: 42     CPU: 200    I/O: 148    TRT: 4817   END: 4859  
+    Thread  2:    ARR: 57     CPU: 99     I/O: 82     TRT: 3345   END: 3402  
+
+Process 740 [NORMAL]:
+    Thread  0:    ARR: 100    CPU: 126    I/O: 119    TRT: 4836   END: 4936  
+    Thread  1:    ARR: 60     CPU: 25     I/O: 15     TRT: 1197   END: 1257  
+    Thread  2:    ARR: 73     CPU: 48     I/O: 48     TRT: 2819   END: 2892  
+    Thread  3:    ARR: 50     CPU: 26     I/O: 19     TRT: 2162   END: 2212  
+
@@ -0,0 +1,37 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  2
+    Avg. response time:       91.50
+    Avg. turnaround time:   1442.00
+
+INTERACTIVE THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+NORMAL THREADS:
+    Total Count:                  1
+    Avg. response time:       47.00
+    Avg. turnaround time:   2160.00
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           2179
+Total service time:            223
+Total I/O time:                191
+Total dispatch time:          1937
+Total idle time:                19
+
+CPU utilization:            99.13%
+CPU efficiency:             10.23%
+
+Contended dispatches:           71
+    SYSTEM          84.51% won,  83.88% entitled
+    INTERACTIVE      0.00% won,   0.00% entitled
+    NORMAL          15.49% won,  16.12% entitled
+    BATCH            0.00% won,   0.00% entitled
+
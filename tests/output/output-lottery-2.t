@@ -0,0 +1,9 @@
+SIMULATION COMPLETED!
+
+Process 59 [SYSTEM]:
+    Thread  0:    ARR: 33     CPU: 54     I/O: 60     TRT: 782    END: 815   
+    Thread  1:    ARR: 29     CPU: 123    I/O: 97     TRT: 2102   END: 2131  
+
+Process 189 [NORMAL]:
+    Thread  0:    ARR: 19     CPU: 46     I/O: 34     TRT: 2160   END: 2179  
+
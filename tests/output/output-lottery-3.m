@@ -0,0 +1,37 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:      119.00
+    Avg. turnaround time:   9076.00
+
+NORMAL THREADS:
+    Total Count:                  8
+    Avg. response time:      582.25
+    Avg. turnaround time:  10859.62
+
+BATCH THREADS:
+    Total Count:                  4
+    Avg. response time:      429.50
+    Avg. turnaround time:  15156.00
+
+Total elapsed time:          17073
+Total service time:           1127
+Total I/O time:                891
+Total dispatch time:         15856
+Total idle time:                90
+
+CPU utilization:            99.47%
+CPU efficiency:              6.60%
+
+Contended dispatches:          360
+    SYSTEM           0.00% won,   0.00% entitled
+    INTERACTIVE     11.67% won,  10.40% entitled
+    NORMAL          61.67% won,  63.67% entitled
+    BATCH           26.67% won,  25.92% entitled
+
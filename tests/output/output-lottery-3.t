@@ -0,0 +1,27 @@
+SIMULATION COMPLETED!
+
+Process 203 [NORMAL]:
+    Thread  0:    ARR: 48     CPU: 135    I/O: 115    TRT: 15826  END: 15874 
+
+Process 297 [BATCH]:
+    Thread  0:    ARR: 10     CPU: 71     I/O: 44     TRT: 15587  END: 15597 
+
+Process 341 [INTERACTIVE]:
+    Thread  0:    ARR: 82     CPU: 121    I/O: 58     TRT: 9076   END: 9158  
+
+Process 395 [NORMAL]:
+    Thread  0:    ARR: 58     CPU: 2      I/O: 0      TRT: 546    END: 604   
+    Thread  1:    ARR: 28     CPU: 105    I/O: 119    TRT: 13991  END: 14019 
+    Thread  2:    ARR: 33     CPU: 70     I/O: 28     TRT: 11546  END: 11579 
+
+Process 404 [BATCH]:
+    Thread  0:    ARR: 0      CPU: 182    I/O: 153    TRT: 17073  END: 17073 
+    Thread  1:    ARR: 53     CPU: 96     I/O: 81     TRT: 16168  END: 16221 
+    Thread  2:    ARR: 58     CPU: 26     I/O: 39     TRT: 11796  END: 11854 
+
+Process 613 [NORMAL]:
+    Thread  0:    ARR: 70     CPU: 74     I/O: 84     TRT: 12032  END: 12102 
+    Thread  1:    ARR: 47     CPU: 119    I/O: 102    TRT: 15927  END: 15974 
+    Thread  2:    ARR: 39     CPU: 14     I/O: 0      TRT: 2626   END: 2665  
+    Thread  3:    ARR: 87     CPU: 112    I/O: 68     TRT: 14383  END: 14470 
+
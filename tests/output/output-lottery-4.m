@@ -0,0 +1,37 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                 13
+    Avg. response time:      738.77
+    Avg. turnaround time:  17418.85
+
+INTERACTIVE THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+NORMAL THREADS:
+    Total Count:                 10
+    Avg. response time:     2496.60
+    Avg. turnaround time:  31010.10
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:          33513
+Total service time:           2134
+Total I/O time:               1835
+Total dispatch time:         31341
+Total idle time:                38
+
+CPU utilization:            99.89%
+CPU efficiency:              6.37%
+
+Contended dispatches:          748
+    SYSTEM          56.42% won,  58.44% entitled
+    INTERACTIVE      0.00% won,   0.00% entitled
+    NORMAL          43.58% won,  41.56% entitled
+    BATCH            0.00% won,   0.00% entitled
+
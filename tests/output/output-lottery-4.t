@@ -0,0 +1,41 @@
+SIMULATION COMPLETED!
+
+Process 71 [SYSTEM]:
+    Thread  0:    ARR: 59     CPU: 99     I/O: 89     TRT: 19693  END: 19752 
+
+Process 104 [SYSTEM]:
+    Thread  0:    ARR: 79     CPU: 57     I/O: 74     TRT: 14021  END: 14100 
+    Thread  1:    ARR: 50     CPU: 239    I/O: 142    TRT: 30001  END: 30051 
+    Thread  2:    ARR: 22     CPU: 64     I/O: 12     TRT: 13569  END: 13591 
+    Thread  3:    ARR: 50     CPU: 89     I/O: 97     TRT: 19104  END: 19154 
+
+Process 242 [NORMAL]:
+    Thread  0:    ARR: 59     CPU: 89     I/O: 84     TRT: 33061  END: 33120 
+    Thread  1:    ARR: 71     CPU: 132    I/O: 126    TRT: 33442  END: 33513 
+    Thread  2:    ARR: 39     CPU: 87     I/O: 88     TRT: 30261  END: 30300 
+
+Process 320 [NORMAL]:
+    Thread  0:    ARR: 23     CPU: 73     I/O: 56     TRT: 30229  END: 30252 
+    Thread  1:    ARR: 92     CPU: 124    I/O: 91     TRT: 32855  END: 32947 
+    Thread  2:    ARR: 71     CPU: 79     I/O: 40     TRT: 31931  END: 32002 
+
+Process 428 [SYSTEM]:
+    Thread  0:    ARR: 25     CPU: 63     I/O: 120    TRT: 15884  END: 15909 
+    Thread  1:    ARR: 95     CPU: 149    I/O: 104    TRT: 25961  END: 26056 
+
+Process 461 [SYSTEM]:
+    Thread  0:    ARR: 44     CPU: 126    I/O: 119    TRT: 19494  END: 19538 
+    Thread  1:    ARR: 67     CPU: 63     I/O: 81     TRT: 15364  END: 15431 
+    Thread  2:    ARR: 47     CPU: 43     I/O: 54     TRT: 10357  END: 10404 
+
+Process 687 [NORMAL]:
+    Thread  0:    ARR: 45     CPU: 80     I/O: 76     TRT: 28875  END: 28920 
+    Thread  1:    ARR: 59     CPU: 57     I/O: 53     TRT: 26241  END: 26300 
+    Thread  2:    ARR: 76     CPU: 74     I/O: 100    TRT: 30022  END: 30098 
+    Thread  3:    ARR: 10     CPU: 147    I/O: 112    TRT: 33184  END: 33194 
+
+Process 729 [SYSTEM]:
+    Thread  0:    ARR: 17     CPU: 37     I/O: 10     TRT: 6866   END: 6883  
+    Thread  1:    ARR: 49     CPU: 87     I/O: 45     TRT: 18498  END: 18547 
+    Thread  2:    ARR: 55     CPU: 76     I/O: 62     TRT: 17633  END: 17688 
+
@@ -0,0 +1,37 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:       57.00
+    Avg. turnaround time:   1691.00
+
+NORMAL THREADS:
+    Total Count:                  1
+    Avg. response time:       36.00
+    Avg. turnaround time:   1546.00
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           1771
+Total service time:            170
+Total I/O time:                185
+Total dispatch time:          1514
+Total idle time:                87
+
+CPU utilization:            95.09%
+CPU efficiency:              9.60%
+
+Contended dispatches:           42
+    SYSTEM           0.00% won,   0.00% entitled
+    INTERACTIVE     71.43% won,  66.67% entitled
+    NORMAL          28.57% won,  33.33% entitled
+    BATCH            0.00% won,   0.00% entitled
+
@@ -0,0 +1,39 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  2
+    Avg. response time:        1.50
+    Avg. turnaround time:     70.00
+
+NORMAL THREADS:
+    Total Count:                  2
+    Avg. response time:       58.00
+    Avg. turnaround time:    131.50
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:            150
+Total service time:            135
+Total I/O time:                  5
+Total dispatch time:            10
+Total idle time:                 5
+
+CPU utilization:            96.67%
+CPU efficiency:             90.00%
+
+Deadline threads:                4
+Deadline misses:                 3
+Avg. tardiness:              48.75
+Tardiness p50:                  51
+Tardiness p90:                  80
+Tardiness p99:                  80
+Tardiness max:                  80
+
@@ -0,0 +1,10 @@
+SIMULATION COMPLETED!
+
+Process 0 [NORMAL]:
+    Thread  0:    ARR: 0      CPU: 40     I/O: 0      TRT: 123    END: 123   
+    Thread  1:    ARR: 10     CPU: 20     I/O: 5      TRT: 140    END: 150   
+
+Process 1 [INTERACTIVE]:
+    Thread  0:    ARR: 15     CPU: 15     I/O: 0      TRT: 79     END: 94    
+    Thread  1:    ARR: 20     CPU: 60     I/O: 0      TRT: 61     END: 81    
+
@@ -0,0 +1,132 @@
+At time 0:
+    THREAD_ARRIVED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 0:
+    DISPATCHER_INVOKED
+    Thread 0 in process 0 [NORMAL]
+    Selected from 1 threads (period = 50). Will run to completion of burst.
+
+At time 2:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10:
+    THREAD_ARRIVED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 15:
+    THREAD_ARRIVED
+    Thread 0 in process 1 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 15:
+    THREAD_PREEMPTED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15:
+    DISPATCHER_INVOKED
+    Thread 0 in process 1 [INTERACTIVE]
+    Selected from 3 threads (period = 25). Will run to completion of burst.
+
+At time 17:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 1 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 20:
+    THREAD_ARRIVED
+    Thread 1 in process 1 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 20:
+    THREAD_PREEMPTED
+    Thread 0 in process 1 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 20:
+    DISPATCHER_INVOKED
+    Thread 1 in process 1 [INTERACTIVE]
+    Selected from 4 threads (relative deadline = 10). Will run to completion of burst.
+
+At time 21:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 1 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 81:
+    THREAD_COMPLETED
+    Thread 1 in process 1 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 81:
+    DISPATCHER_INVOKED
+    Thread 0 in process 1 [INTERACTIVE]
+    Selected from 3 threads (period = 25). Will run to completion of burst.
+
+At time 82:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 1 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 94:
+    THREAD_COMPLETED
+    Thread 0 in process 1 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 94:
+    DISPATCHER_INVOKED
+    Thread 0 in process 0 [NORMAL]
+    Selected from 2 threads (period = 50). Will run to completion of burst.
+
+At time 96:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 123:
+    THREAD_COMPLETED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 123:
+    DISPATCHER_INVOKED
+    Thread 1 in process 0 [NORMAL]
+    Selected from 1 threads (period = 100). Will run to completion of burst.
+
+At time 124:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 134:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 139:
+    IO_BURST_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 139:
+    DISPATCHER_INVOKED
+    Thread 1 in process 0 [NORMAL]
+    Selected from 1 threads (period = 100). Will run to completion of burst.
+
+At time 140:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 150:
+    THREAD_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  3
+    Avg. response time:      111.00
+    Avg. turnaround time:   1233.67
+
+NORMAL THREADS:
+    Total Count:                  4
+    Avg. response time:      224.50
+    Avg. turnaround time:    795.25
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           1678
+Total service time:            628
+Total I/O time:                517
+Total dispatch time:           969
+Total idle time:                81
+
+CPU utilization:            95.17%
+CPU efficiency:             37.43%
+
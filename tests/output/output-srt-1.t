@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+Process 642 [INTERACTIVE]:
+    Thread  0:    ARR: 50     CPU: 104    I/O: 86     TRT: 955    END: 1005  
+    Thread  1:    ARR: 42     CPU: 200    I/O: 148    TRT: 1636   END: 1678  
+    Thread  2:    ARR: 57     CPU: 99     I/O: 82     TRT: 1110   END: 1167  
+
+Process 740 [NORMAL]:
+    Thread  0:    ARR: 100    CPU: 126    I/O: 119    TRT: 1414   END: 1514  
+    Thread  1:    ARR: 60     CPU: 25     I/O: 15     TRT: 313    END: 373   
+    Thread  2:    ARR: 73     CPU: 48     I/O: 48     TRT: 869    END: 942   
+    Thread  3:    ARR: 50     CPU: 26     I/O: 19     TRT: 585    END: 635   
+
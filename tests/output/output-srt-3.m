@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:      755.00
+    Avg. turnaround time:   3357.00
+
+NORMAL THREADS:
+    Total Count:                  8
+    Avg. response time:      457.00
+    Avg. turnaround time:   2339.25
+
+BATCH THREADS:
+    Total Count:                  4
+    Avg. response time:      342.25
+    Avg. turnaround time:   3169.25
+
+Total elapsed time:           4265
+Total service time:           1127
+Total I/O time:                891
+Total dispatch time:          3138
+Total idle time:                 0
+
+CPU utilization:           100.00%
+CPU efficiency:             26.42%
+
@@ -0,0 +1,27 @@
+SIMULATION COMPLETED!
+
+Process 203 [NORMAL]:
+    Thread  0:    ARR: 48     CPU: 135    I/O: 115    TRT: 2663   END: 2711  
+
+Process 297 [BATCH]:
+    Thread  0:    ARR: 10     CPU: 71     I/O: 44     TRT: 4066   END: 4076  
+
+Process 341 [INTERACTIVE]:
+    Thread  0:    ARR: 82     CPU: 121    I/O: 58     TRT: 3357   END: 3439  
+
+Process 395 [NORMAL]:
+    Thread  0:    ARR: 58     CPU: 2      I/O: 0      TRT: 612    END: 670   
+    Thread  1:    ARR: 28     CPU: 105    I/O: 119    TRT: 1830   END: 1858  
+    Thread  2:    ARR: 33     CPU: 70     I/O: 28     TRT: 4183   END: 4216  
+
+Process 404 [BATCH]:
+    Thread  0:    ARR: 0      CPU: 182    I/O: 153    TRT: 4265   END: 4265  
+    Thread  1:    ARR: 53     CPU: 96     I/O: 81     TRT: 3194   END: 3247  
+    Thread  2:    ARR: 58     CPU: 26     I/O: 39     TRT: 1152   END: 1210  
+
+Process 613 [NORMAL]:
+    Thread  0:    ARR: 70     CPU: 74     I/O: 84     TRT: 2322   END: 2392  
+    Thread  1:    ARR: 47     CPU: 119    I/O: 102    TRT: 2948   END: 2995  
+    Thread  2:    ARR: 39     CPU: 14     I/O: 0      TRT: 296    END: 335   
+    Thread  3:    ARR: 87     CPU: 112    I/O: 68     TRT: 3860   END: 3947  
+
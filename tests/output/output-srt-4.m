@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                 13
+    Avg. response time:      958.54
+    Avg. turnaround time:   5249.77
+
+INTERACTIVE THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+NORMAL THREADS:
+    Total Count:                 10
+    Avg. response time:     1071.10
+    Avg. turnaround time:   6019.80
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           8216
+Total service time:           2134
+Total I/O time:               1835
+Total dispatch time:          6045
+Total idle time:                37
+
+CPU utilization:            99.55%
+CPU efficiency:             25.97%
+
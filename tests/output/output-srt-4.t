@@ -0,0 +1,41 @@
+SIMULATION COMPLETED!
+
+Process 71 [SYSTEM]:
+    Thread  0:    ARR: 59     CPU: 99     I/O: 89     TRT: 5891   END: 5950  
+
+Process 104 [SYSTEM]:
+    Thread  0:    ARR: 79     CPU: 57     I/O: 74     TRT: 5177   END: 5256  
+    Thread  1:    ARR: 50     CPU: 239    I/O: 142    TRT: 8166   END: 8216  
+    Thread  2:    ARR: 22     CPU: 64     I/O: 12     TRT: 5477   END: 5499  
+    Thread  3:    ARR: 50     CPU: 89     I/O: 97     TRT: 5090   END: 5140  
+
+Process 242 [NORMAL]:
+    Thread  0:    ARR: 59     CPU: 89     I/O: 84     TRT: 7748   END: 7807  
+    Thread  1:    ARR: 71     CPU: 132    I/O: 126    TRT: 7763   END: 7834  
+    Thread  2:    ARR: 39     CPU: 87     I/O: 88     TRT: 4072   END: 4111  
+
+Process 320 [NORMAL]:
+    Thread  0:    ARR: 23     CPU: 73     I/O: 56     TRT: 4328   END: 4351  
+    Thread  1:    ARR: 92     CPU: 124    I/O: 91     TRT: 7231   END: 7323  
+    Thread  2:    ARR: 71     CPU: 79     I/O: 40     TRT: 7546   END: 7617  
+
+Process 428 [SYSTEM]:
+    Thread  0:    ARR: 25     CPU: 63     I/O: 120    TRT: 2773   END: 2798  
+    Thread  1:    ARR: 95     CPU: 149    I/O: 104    TRT: 7919   END: 8014  
+
+Process 461 [SYSTEM]:
+    Thread  0:    ARR: 44     CPU: 126    I/O: 119    TRT: 5661   END: 5705  
+    Thread  1:    ARR: 67     CPU: 63     I/O: 81     TRT: 6114   END: 6181  
+    Thread  2:    ARR: 47     CPU: 43     I/O: 54     TRT: 943    END: 990   
+
+Process 687 [NORMAL]:
+    Thread  0:    ARR: 45     CPU: 80     I/O: 76     TRT: 6591   END: 6636  
+    Thread  1:    ARR: 59     CPU: 57     I/O: 53     TRT: 3757   END: 3816  
+    Thread  2:    ARR: 76     CPU: 74     I/O: 100    TRT: 4926   END: 5002  
+    Thread  3:    ARR: 10     CPU: 147    I/O: 112    TRT: 6236   END: 6246  
+
+Process 729 [SYSTEM]:
+    Thread  0:    ARR: 17     CPU: 37     I/O: 10     TRT: 2382   END: 2399  
+    Thread  1:    ARR: 49     CPU: 87     I/O: 45     TRT: 6637   END: 6686  
+    Thread  2:    ARR: 55     CPU: 76     I/O: 62     TRT: 6017   END: 6072  
+
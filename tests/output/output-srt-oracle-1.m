@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  3
+    Avg. response time:       99.67
+    Avg. turnaround time:   1179.33
+
+NORMAL THREADS:
+    Total Count:                  4
+    Avg. response time:      268.75
+    Avg. turnaround time:    721.75
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           1681
+Total service time:            628
+Total I/O time:                517
+Total dispatch time:           972
+Total idle time:                81
+
+CPU utilization:            95.18%
+CPU efficiency:             37.36%
+
@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+Process 642 [INTERACTIVE]:
+    Thread  0:    ARR: 50     CPU: 104    I/O: 86     TRT: 786    END: 836   
+    Thread  1:    ARR: 42     CPU: 200    I/O: 148    TRT: 1639   END: 1681  
+    Thread  2:    ARR: 57     CPU: 99     I/O: 82     TRT: 1113   END: 1170  
+
+Process 740 [NORMAL]:
+    Thread  0:    ARR: 100    CPU: 126    I/O: 119    TRT: 1417   END: 1517  
+    Thread  1:    ARR: 60     CPU: 25     I/O: 15     TRT: 324    END: 384   
+    Thread  2:    ARR: 73     CPU: 48     I/O: 48     TRT: 804    END: 877   
+    Thread  3:    ARR: 50     CPU: 26     I/O: 19     TRT: 342    END: 392   
+
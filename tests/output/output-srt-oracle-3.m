@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:      505.00
+    Avg. turnaround time:   3949.00
+
+NORMAL THREADS:
+    Total Count:                  8
+    Avg. response time:     1203.12
+    Avg. turnaround time:   2168.50
+
+BATCH THREADS:
+    Total Count:                  4
+    Avg. response time:      341.75
+    Avg. turnaround time:   2583.75
+
+Total elapsed time:           4154
+Total service time:           1127
+Total I/O time:                891
+Total dispatch time:          3002
+Total idle time:                25
+
+CPU utilization:            99.40%
+CPU efficiency:             27.13%
+
@@ -0,0 +1,27 @@
+SIMULATION COMPLETED!
+
+Process 203 [NORMAL]:
+    Thread  0:    ARR: 48     CPU: 135    I/O: 115    TRT: 3183   END: 3231  
+
+Process 297 [BATCH]:
+    Thread  0:    ARR: 10     CPU: 71     I/O: 44     TRT: 2140   END: 2150  
+
+Process 341 [INTERACTIVE]:
+    Thread  0:    ARR: 82     CPU: 121    I/O: 58     TRT: 3949   END: 4031  
+
+Process 395 [NORMAL]:
+    Thread  0:    ARR: 58     CPU: 2      I/O: 0      TRT: 70     END: 128   
+    Thread  1:    ARR: 28     CPU: 105    I/O: 119    TRT: 3930   END: 3958  
+    Thread  2:    ARR: 33     CPU: 70     I/O: 28     TRT: 2845   END: 2878  
+
+Process 404 [BATCH]:
+    Thread  0:    ARR: 0      CPU: 182    I/O: 153    TRT: 4154   END: 4154  
+    Thread  1:    ARR: 53     CPU: 96     I/O: 81     TRT: 3560   END: 3613  
+    Thread  2:    ARR: 58     CPU: 26     I/O: 39     TRT: 481    END: 539   
+
+Process 613 [NORMAL]:
+    Thread  0:    ARR: 70     CPU: 74     I/O: 84     TRT: 1503   END: 1573  
+    Thread  1:    ARR: 47     CPU: 119    I/O: 102    TRT: 1836   END: 1883  
+    Thread  2:    ARR: 39     CPU: 14     I/O: 0      TRT: 386    END: 425   
+    Thread  3:    ARR: 87     CPU: 112    I/O: 68     TRT: 3595   END: 3682  
+
@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                 13
+    Avg. response time:     1939.08
+    Avg. turnaround time:   5314.15
+
+INTERACTIVE THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+NORMAL THREADS:
+    Total Count:                 10
+    Avg. response time:     1520.50
+    Avg. turnaround time:   5497.20
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           8268
+Total service time:           2134
+Total I/O time:               1835
+Total dispatch time:          6090
+Total idle time:                44
+
+CPU utilization:            99.47%
+CPU efficiency:             25.81%
+
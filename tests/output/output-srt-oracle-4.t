@@ -0,0 +1,41 @@
+SIMULATION COMPLETED!
+
+Process 71 [SYSTEM]:
+    Thread  0:    ARR: 59     CPU: 99     I/O: 89     TRT: 7596   END: 7655  
+
+Process 104 [SYSTEM]:
+    Thread  0:    ARR: 79     CPU: 57     I/O: 74     TRT: 7250   END: 7329  
+    Thread  1:    ARR: 50     CPU: 239    I/O: 142    TRT: 7679   END: 7729  
+    Thread  2:    ARR: 22     CPU: 64     I/O: 12     TRT: 2972   END: 2994  
+    Thread  3:    ARR: 50     CPU: 89     I/O: 97     TRT: 3438   END: 3488  
+
+Process 242 [NORMAL]:
+    Thread  0:    ARR: 59     CPU: 89     I/O: 84     TRT: 8209   END: 8268  
+    Thread  1:    ARR: 71     CPU: 132    I/O: 126    TRT: 5832   END: 5903  
+    Thread  2:    ARR: 39     CPU: 87     I/O: 88     TRT: 2549   END: 2588  
+
+Process 320 [NORMAL]:
+    Thread  0:    ARR: 23     CPU: 73     I/O: 56     TRT: 2780   END: 2803  
+    Thread  1:    ARR: 92     CPU: 124    I/O: 91     TRT: 6256   END: 6348  
+    Thread  2:    ARR: 71     CPU: 79     I/O: 40     TRT: 7515   END: 7586  
+
+Process 428 [SYSTEM]:
+    Thread  0:    ARR: 25     CPU: 63     I/O: 120    TRT: 1671   END: 1696  
+    Thread  1:    ARR: 95     CPU: 149    I/O: 104    TRT: 8011   END: 8106  
+
+Process 461 [SYSTEM]:
+    Thread  0:    ARR: 44     CPU: 126    I/O: 119    TRT: 4283   END: 4327  
+    Thread  1:    ARR: 67     CPU: 63     I/O: 81     TRT: 5262   END: 5329  
+    Thread  2:    ARR: 47     CPU: 43     I/O: 54     TRT: 5606   END: 5653  
+
+Process 687 [NORMAL]:
+    Thread  0:    ARR: 45     CPU: 80     I/O: 76     TRT: 7226   END: 7271  
+    Thread  1:    ARR: 59     CPU: 57     I/O: 53     TRT: 5522   END: 5581  
+    Thread  2:    ARR: 76     CPU: 74     I/O: 100    TRT: 4814   END: 4890  
+    Thread  3:    ARR: 10     CPU: 147    I/O: 112    TRT: 4269   END: 4279  
+
+Process 729 [SYSTEM]:
+    Thread  0:    ARR: 17     CPU: 37     I/O: 10     TRT: 4448   END: 4465  
+    Thread  1:    ARR: 49     CPU: 87     I/O: 45     TRT: 5413   END: 5462  
+    Thread  2:    ARR: 55     CPU: 76     I/O: 62     TRT: 5455   END: 5510  
+
@@ -0,0 +1,37 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  3
+    Avg. response time:       80.00
+    Avg. turnaround time:   3297.33
+
+NORMAL THREADS:
+    Total Count:                  4
+    Avg. response time:      110.25
+    Avg. turnaround time:   2487.00
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           4424
+Total service time:            628
+Total I/O time:                517
+Total dispatch time:          3732
+Total idle time:                64
+
+CPU utilization:            98.55%
+CPU efficiency:             14.20%
+
+Contended dispatches:          203
+    SYSTEM           0.00% won,   0.00% entitled
+    INTERACTIVE     67.00% won,  66.84% entitled
+    NORMAL          33.00% won,  33.16% entitled
+    BATCH            0.00% won,   0.00% entitled
+
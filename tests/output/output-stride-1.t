@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+Process 642 [INTERACTIVE]:
+    Thread  0:    ARR: 50     CPU: 104    I/O: 86     TRT: 2892   END: 2942  
+    Thread  1:    ARR: 42     CPU: 200    I/O: 148    TRT: 4281   END: 4323  
+    Thread  2:    ARR: 57     CPU: 99     I/O: 82     TRT: 2719   END: 2776  
+
+Process 740 [NORMAL]:
+    Thread  0:    ARR: 100    CPU: 126    I/O: 119    TRT: 4324   END: 4424  
+    Thread  1:    ARR: 60     CPU: 25     I/O: 15     TRT: 1477   END: 1537  
+    Thread  2:    ARR: 73     CPU: 48     I/O: 48     TRT: 2555   END: 2628  
+    Thread  3:    ARR: 50     CPU: 26     I/O: 19     TRT: 1592   END: 1642  
+
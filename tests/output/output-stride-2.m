@@ -0,0 +1,37 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  2
+    Avg. response time:       91.50
+    Avg. turnaround time:   1361.50
+
+INTERACTIVE THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+NORMAL THREADS:
+    Total Count:                  1
+    Avg. response time:       47.00
+    Avg. turnaround time:   1938.00
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           1957
+Total service time:            223
+Total I/O time:                191
+Total dispatch time:          1715
+Total idle time:                19
+
+CPU utilization:            99.03%
+CPU efficiency:             11.39%
+
+Contended dispatches:           68
+    SYSTEM          88.24% won,  84.31% entitled
+    INTERACTIVE      0.00% won,   0.00% entitled
+    NORMAL          11.76% won,  15.69% entitled
+    BATCH            0.00% won,   0.00% entitled
+
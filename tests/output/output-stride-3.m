@@ -0,0 +1,37 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:      468.00
+    Avg. turnaround time:  10065.00
+
+NORMAL THREADS:
+    Total Count:                  8
+    Avg. response time:      271.75
+    Avg. turnaround time:  10829.38
+
+BATCH THREADS:
+    Total Count:                  4
+    Avg. response time:      205.25
+    Avg. turnaround time:  14725.50
+
+Total elapsed time:          17508
+Total service time:           1127
+Total I/O time:                891
+Total dispatch time:         16291
+Total idle time:                90
+
+CPU utilization:            99.49%
+CPU efficiency:              6.44%
+
+Contended dispatches:          364
+    SYSTEM           0.00% won,   0.00% entitled
+    INTERACTIVE     11.54% won,  11.55% entitled
+    NORMAL          60.99% won,  60.90% entitled
+    BATCH           27.47% won,  27.55% entitled
+
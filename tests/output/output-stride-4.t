@@ -0,0 +1,41 @@
+SIMULATION COMPLETED!
+
+Process 71 [SYSTEM]:
+    Thread  0:    ARR: 59     CPU: 99     I/O: 89     TRT: 19512  END: 19571 
+
+Process 104 [SYSTEM]:
+    Thread  0:    ARR: 79     CPU: 57     I/O: 74     TRT: 13772  END: 13851 
+    Thread  1:    ARR: 50     CPU: 239    I/O: 142    TRT: 29042  END: 29092 
+    Thread  2:    ARR: 22     CPU: 64     I/O: 12     TRT: 15217  END: 15239 
+    Thread  3:    ARR: 50     CPU: 89     I/O: 97     TRT: 18729  END: 18779 
+
+Process 242 [NORMAL]:
+    Thread  0:    ARR: 59     CPU: 89     I/O: 84     TRT: 32249  END: 32308 
+    Thread  1:    ARR: 71     CPU: 132    I/O: 126    TRT: 34177  END: 34248 
+    Thread  2:    ARR: 39     CPU: 87     I/O: 88     TRT: 31956  END: 31995 
+
+Process 320 [NORMAL]:
+    Thread  0:    ARR: 23     CPU: 73     I/O: 56     TRT: 30835  END: 30858 
+    Thread  1:    ARR: 92     CPU: 124    I/O: 91     TRT: 33868  END: 33960 
+    Thread  2:    ARR: 71     CPU: 79     I/O: 40     TRT: 31415  END: 31486 
+
+Process 428 [SYSTEM]:
+    Thread  0:    ARR: 25     CPU: 63     I/O: 120    TRT: 15019  END: 15044 
+    Thread  1:    ARR: 95     CPU: 149    I/O: 104    TRT: 23780  END: 23875 
+
+Process 461 [SYSTEM]:
+    Thread  0:    ARR: 44     CPU: 126    I/O: 119    TRT: 22010  END: 22054 
+    Thread  1:    ARR: 67     CPU: 63     I/O: 81     TRT: 14931  END: 14998 
+    Thread  2:    ARR: 47     CPU: 43     I/O: 54     TRT: 10431  END: 10478 
+
+Process 687 [NORMAL]:
+    Thread  0:    ARR: 45     CPU: 80     I/O: 76     TRT: 31535  END: 31580 
+    Thread  1:    ARR: 59     CPU: 57     I/O: 53     TRT: 27928  END: 27987 
+    Thread  2:    ARR: 76     CPU: 74     I/O: 100    TRT: 30709  END: 30785 
+    Thread  3:    ARR: 10     CPU: 147    I/O: 112    TRT: 34420  END: 34430 
+
+Process 729 [SYSTEM]:
+    Thread  0:    ARR: 17     CPU: 37     I/O: 10     TRT: 8972   END: 8989  
+    Thread  1:    ARR: 49     CPU: 87     I/O: 45     TRT: 18492  END: 18541 
+    Thread  2:    ARR: 55     CPU: 76     I/O: 62     TRT: 16793  END: 16848 
+
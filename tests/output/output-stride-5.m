@@ -0,0 +1,37 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:       57.00
+    Avg. turnaround time:   1930.00
+
+NORMAL THREADS:
+    Total Count:                  1
+    Avg. response time:       36.00
+    Avg. turnaround time:   1893.00
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           2010
+Total service time:            170
+Total I/O time:                185
+Total dispatch time:          1778
+Total idle time:                62
+
+CPU utilization:            96.92%
+CPU efficiency:              8.46%
+
+Contended dispatches:           46
+    SYSTEM           0.00% won,   0.00% entitled
+    INTERACTIVE     76.09% won,  66.67% entitled
+    NORMAL          23.91% won,  33.33% entitled
+    BATCH            0.00% won,   0.00% entitled
+